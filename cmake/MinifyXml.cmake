@@ -0,0 +1,10 @@
+# Usage: cmake -DIN=<file.xml> -DOUT=<file.xml> -P MinifyXml.cmake
+#
+# Strips comments and collapses whitespace so the embedded cascade is smaller
+# and quicker for cv::FileStorage to parse.
+file(READ "${IN}" XML)
+string(REGEX REPLACE "<!--([^-]|-[^-]|--[^>])*-->" "" XML "${XML}")
+string(REGEX REPLACE "[ \t\r\n]+" " " XML "${XML}")
+string(REPLACE "> <" "><" XML "${XML}")
+string(STRIP "${XML}" XML)
+file(WRITE "${OUT}" "${XML}")
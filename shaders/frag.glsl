@@ -2,19 +2,30 @@
 in vec2 TexCoord;
 in vec3 FragPos;
 in vec3 Normal;
+in vec4 Tangent;
+flat in float BaseColorLayer;
+flat in float HasNormalMap;
 
 out vec4 FragColor;
 
-uniform sampler2D uBaseColorTexture;
+uniform sampler2DArray uBaseColorTexture;
+uniform sampler2D uNormalTexture;
 uniform vec3      uLightDir;
 uniform vec3      uAmbient;
 
 void main() {
-    vec4 tex = texture(uBaseColorTexture, TexCoord);
+    vec4 tex = texture(uBaseColorTexture, vec3(TexCoord, BaseColorLayer));
     // discard fully transparent pixels
     if (tex.a < 0.1) discard;
 
     vec3 norm = normalize(Normal);
+    if (HasNormalMap > 0.5) {
+        // Tangent-space normal map, glTF convention
+        vec3 t = normalize(Tangent.xyz - norm * dot(norm, Tangent.xyz));
+        vec3 b = cross(norm, t) * Tangent.w;
+        vec3 n = texture(uNormalTexture, TexCoord).xyz * 2.0 - 1.0;
+        norm = normalize(mat3(t, b, norm) * n);
+    }
     float diff = max(dot(norm, normalize(uLightDir)), 0.0);
     vec3 color = tex.rgb * (uAmbient + diff);
 
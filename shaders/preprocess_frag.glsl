@@ -0,0 +1,27 @@
+#version 330 core
+// Camera frame reductions for head tracking (see GpuPreprocess.cpp): a box
+// filter downscale, optionally to BT.601 luma as cv::COLOR_BGR2GRAY computes
+// it. The output may carry a border that repeats the edge pixels.
+uniform sampler2D uSource;
+uniform vec2  uOutSize;     // output image in px, without the border
+uniform float uBorder;      // border around the output image, px
+uniform vec2  uSrcOrigin;   // source image within uSource, uv
+uniform vec2  uSrcExtent;
+uniform vec2  uTapStep;     // between bilinear taps, uv
+uniform int   uTaps;        // per axis
+uniform bool  uGray;        // luma of an RGB source; off for gray to gray
+
+out vec4 fragColor;
+
+void main() {
+    vec2 px = clamp(gl_FragCoord.xy - uBorder, vec2(0.5), uOutSize - 0.5);
+    vec2 uv = px / uOutSize;
+    vec2 centre = uSrcOrigin + uv * uSrcExtent;
+    vec2 first = centre - uTapStep * (float(uTaps) - 1.0) * 0.5;
+    vec3 sum = vec3(0.0);
+    for (int y = 0; y < uTaps; ++y)
+        for (int x = 0; x < uTaps; ++x)
+            sum += texture(uSource, first + uTapStep * vec2(x, y)).rgb;
+    vec3 c = sum / float(uTaps * uTaps);
+    fragColor = uGray ? vec4(dot(c, vec3(0.299, 0.587, 0.114))) : vec4(c, 1.0);
+}
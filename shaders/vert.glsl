@@ -2,19 +2,62 @@
 layout(location=0) in vec3 aPos;
 layout(location=1) in vec3 aNormal;
 layout(location=2) in vec2 aUV;
+layout(location=3) in vec4 aJoints;
+layout(location=4) in vec4 aWeights;
+layout(location=5) in vec4 aTangent;   // xyz + handedness
+layout(location=6) in uint aDrawId;
 
-uniform mat4 uModel;
 uniform mat4 uView;
 uniform mat4 uProj;
 
+// Per-draw state, 5 texels per draw id: model matrix, then
+// (skinned, joint base, base color layer, has normal map). Each instance has
+// uDrawsPerInstance rows.
+uniform samplerBuffer uDrawTable;
+uniform int uDrawsPerInstance;
+
+// Skinning: 4 texels per joint matrix
+uniform samplerBuffer uJointMats;
+
 out vec2 TexCoord;
 out vec3 FragPos;
 out vec3 Normal;
+out vec4 Tangent;
+flat out float BaseColorLayer;
+flat out float HasNormalMap;
+
+mat4 jointMatrix(int jointBase, float j) {
+    int base = (jointBase + int(j)) * 4;
+    return mat4(texelFetch(uJointMats, base),
+                texelFetch(uJointMats, base + 1),
+                texelFetch(uJointMats, base + 2),
+                texelFetch(uJointMats, base + 3));
+}
 
 void main() {
-    vec4 worldPos = uModel * vec4(aPos,1.0);
+    int  row    = (gl_InstanceID * uDrawsPerInstance + int(aDrawId)) * 5;
+    mat4 meshModel = mat4(texelFetch(uDrawTable, row),
+                          texelFetch(uDrawTable, row + 1),
+                          texelFetch(uDrawTable, row + 2),
+                          texelFetch(uDrawTable, row + 3));
+    vec4 params = texelFetch(uDrawTable, row + 4);
+    int  jointBase = int(params.y);
+
+    mat4 model = meshModel;
+    float wsum = aWeights.x + aWeights.y + aWeights.z + aWeights.w;
+    if (params.x > 0.5 && wsum > 0.0) {
+        mat4 skin = aWeights.x * jointMatrix(jointBase, aJoints.x)
+                  + aWeights.y * jointMatrix(jointBase, aJoints.y)
+                  + aWeights.z * jointMatrix(jointBase, aJoints.z)
+                  + aWeights.w * jointMatrix(jointBase, aJoints.w);
+        model = meshModel * (skin / wsum);
+    }
+    BaseColorLayer = params.z;
+    HasNormalMap   = params.w;
+    vec4 worldPos = model * vec4(aPos,1.0);
     FragPos = worldPos.xyz;
-    Normal  = mat3(transpose(inverse(uModel))) * aNormal;
+    Normal  = mat3(transpose(inverse(model))) * aNormal;
+    Tangent = vec4(mat3(model) * aTangent.xyz, aTangent.w);
     TexCoord = aUV;
     gl_Position = uProj * uView * worldPos;
 }
@@ -0,0 +1,39 @@
+#version 450
+layout(location=0) in vec2 TexCoord;
+layout(location=1) in vec3 FragPos;
+layout(location=2) in vec3 Normal;
+layout(location=3) in vec4 Tangent;
+layout(location=4) flat in float HasNormalMap;
+
+layout(location=0) out vec4 FragColor;
+
+layout(set=0, binding=0) uniform Frame {
+    mat4 uView;
+    mat4 uProj;
+    vec4 uLightDir;
+    vec4 uAmbient;
+    uint uDrawsPerInstance;
+};
+
+// Per material
+layout(set=1, binding=0) uniform sampler2D uBaseColorTexture;
+layout(set=1, binding=1) uniform sampler2D uNormalTexture;
+
+void main() {
+    vec4 tex = texture(uBaseColorTexture, TexCoord);
+    // discard fully transparent pixels
+    if (tex.a < 0.1) discard;
+
+    vec3 norm = normalize(Normal);
+    if (HasNormalMap > 0.5) {
+        // Tangent-space normal map, glTF convention
+        vec3 t = normalize(Tangent.xyz - norm * dot(norm, Tangent.xyz));
+        vec3 b = cross(norm, t) * Tangent.w;
+        vec3 n = texture(uNormalTexture, TexCoord).xyz * 2.0 - 1.0;
+        norm = normalize(mat3(t, b, norm) * n);
+    }
+    float diff = max(dot(norm, normalize(uLightDir.xyz)), 0.0);
+    vec3 color = tex.rgb * (uAmbient.rgb + diff);
+
+    FragColor = vec4(color, tex.a);
+}
@@ -0,0 +1,63 @@
+#version 450
+// Vulkan counterpart of shaders/vert.glsl; per-frame data comes from
+// storage buffers instead of buffer textures.
+layout(location=0) in vec3 aPos;
+layout(location=1) in vec3 aNormal;
+layout(location=2) in vec2 aUV;
+layout(location=3) in vec4 aJoints;
+layout(location=4) in vec4 aWeights;
+layout(location=5) in vec4 aTangent;   // xyz + handedness
+layout(location=6) in uint aDrawId;
+
+layout(set=0, binding=0) uniform Frame {
+    mat4 uView;
+    mat4 uProj;
+    vec4 uLightDir;
+    vec4 uAmbient;
+    uint uDrawsPerInstance;
+};
+
+// Per-draw state: model matrix, then (skinned, joint base, unused, has normal
+// map); uDrawsPerInstance entries per instance
+struct Draw {
+    mat4 model;
+    vec4 params;
+};
+layout(std430, set=0, binding=1) readonly buffer DrawTable { Draw uDraws[]; };
+layout(std430, set=0, binding=2) readonly buffer Joints    { mat4 uJointMats[]; };
+
+layout(location=0) out vec2 TexCoord;
+layout(location=1) out vec3 FragPos;
+layout(location=2) out vec3 Normal;
+layout(location=3) out vec4 Tangent;
+layout(location=4) flat out float HasNormalMap;
+
+mat4 jointMatrix(int jointBase, float j) {
+    return uJointMats[jointBase + int(j)];
+}
+
+void main() {
+    Draw d = uDraws[uint(gl_InstanceIndex) * uDrawsPerInstance + aDrawId];
+    int  jointBase = int(d.params.y);
+
+    mat4 model = d.model;
+    float wsum = aWeights.x + aWeights.y + aWeights.z + aWeights.w;
+    if (d.params.x > 0.5 && wsum > 0.0) {
+        mat4 skin = aWeights.x * jointMatrix(jointBase, aJoints.x)
+                  + aWeights.y * jointMatrix(jointBase, aJoints.y)
+                  + aWeights.z * jointMatrix(jointBase, aJoints.z)
+                  + aWeights.w * jointMatrix(jointBase, aJoints.w);
+        model = d.model * (skin / wsum);
+    }
+    HasNormalMap = d.params.w;
+
+    vec4 worldPos = model * vec4(aPos, 1.0);
+    FragPos = worldPos.xyz;
+    Normal  = mat3(transpose(inverse(model))) * aNormal;
+    Tangent = vec4(mat3(model) * aTangent.xyz, aTangent.w);
+    TexCoord = aUV;
+    gl_Position = uProj * uView * worldPos;
+    // The projection follows GL conventions: flip y, map z to [0, 1]
+    gl_Position.y = -gl_Position.y;
+    gl_Position.z = (gl_Position.z + gl_Position.w) * 0.5;
+}
@@ -0,0 +1,128 @@
+#include "AllocCounter.hpp"
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <opencv2/opencv.hpp>
+
+// Plain data, so both are constant-initialized and safe to touch from the
+// very first allocation of a thread
+static thread_local AllocStats counters;
+static thread_local int        externalDepth = 0;
+
+static void record(std::size_t size) {
+    if (externalDepth) {
+        ++counters.external;
+    } else {
+        ++counters.count;
+        counters.bytes += size;
+    }
+}
+
+static void* allocate(std::size_t size, std::size_t align) {
+    if (size == 0) size = 1;
+    for (;;) {
+        void* p = nullptr;
+        if (align <= alignof(std::max_align_t)) p = std::malloc(size);
+        else if (posix_memalign(&p, align, size) != 0) p = nullptr;
+        if (p) {
+            record(size);
+            return p;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) return nullptr;
+        handler();
+    }
+}
+
+static void* allocateOrThrow(std::size_t size, std::size_t align) {
+    void* p = allocate(size, align);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new(std::size_t size) { return allocateOrThrow(size, 0); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size, 0); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, 0); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, 0); }
+void* operator new(std::size_t size, std::align_val_t a) { return allocateOrThrow(size, (std::size_t)a); }
+void* operator new[](std::size_t size, std::align_val_t a) { return allocateOrThrow(size, (std::size_t)a); }
+void* operator new(std::size_t size, std::align_val_t a, const std::nothrow_t&) noexcept {
+    return allocate(size, (std::size_t)a);
+}
+void* operator new[](std::size_t size, std::align_val_t a, const std::nothrow_t&) noexcept {
+    return allocate(size, (std::size_t)a);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+
+AllocStats threadAllocStats() {
+    return counters;
+}
+
+ExternalAllocScope::ExternalAllocScope() { ++externalDepth; }
+ExternalAllocScope::~ExternalAllocScope() { --externalDepth; }
+
+namespace {
+
+// Hands every request to OpenCV's standard allocator and counts the buffers
+// it makes. Buffers keep the standard allocator as their owner, so they are
+// freed the same way whether or not a scope is still open.
+class CountingMatAllocator : public cv::MatAllocator {
+public:
+    explicit CountingMatAllocator(cv::MatAllocator* inner) : inner(inner) {}
+
+    cv::UMatData* allocate(int dims, const int* sizes, int type, void* data, size_t* step,
+                           cv::AccessFlag flags, cv::UMatUsageFlags usage) const override {
+        cv::UMatData* u = inner->allocate(dims, sizes, type, data, step, flags, usage);
+        if (u && !data) {
+            std::size_t size = CV_ELEM_SIZE(type);
+            for (int i = 0; i < dims; ++i) size *= (std::size_t)sizes[i];
+            record(size);
+        }
+        return u;
+    }
+
+    bool allocate(cv::UMatData* u, cv::AccessFlag flags, cv::UMatUsageFlags usage) const override {
+        return inner->allocate(u, flags, usage);
+    }
+
+    void deallocate(cv::UMatData* u) const override { inner->deallocate(u); }
+
+private:
+    cv::MatAllocator* inner;
+};
+
+}  // namespace
+
+MatAllocScope::MatAllocScope() : previous(cv::Mat::getDefaultAllocator()) {
+    static CountingMatAllocator counting(cv::Mat::getStdAllocator());
+    cv::Mat::setDefaultAllocator(&counting);
+}
+
+MatAllocScope::~MatAllocScope() { cv::Mat::setDefaultAllocator(previous); }
+
+FrameAllocCounter::FrameAllocCounter() : last(threadAllocStats()) {}
+
+AllocStats FrameAllocCounter::lap() {
+    AllocStats now = threadAllocStats();
+    AllocStats d;
+    d.count    = now.count - last.count;
+    d.bytes    = now.bytes - last.bytes;
+    d.external = now.external - last.external;
+    last = now;
+    ++frames;
+    if (d.count) ++allocatingFrames;
+    allocations += d.count;
+    return d;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+
+namespace cv { class MatAllocator; }
+
+// Heap allocations made through the global operator new, counted per thread.
+// Reads from capture backends, which we cannot change, run inside an
+// ExternalAllocScope and are counted apart, so a frame can be checked for
+// allocations everywhere else.
+struct AllocStats {
+    uint64_t count    = 0;  // allocations outside any ExternalAllocScope
+    uint64_t bytes    = 0;
+    uint64_t external = 0;  // allocations inside one
+};
+
+// Totals for the calling thread since it started
+AllocStats threadAllocStats();
+
+class ExternalAllocScope {
+public:
+    ExternalAllocScope();
+    ~ExternalAllocScope();
+    ExternalAllocScope(const ExternalAllocScope&) = delete;
+    ExternalAllocScope& operator=(const ExternalAllocScope&) = delete;
+};
+
+// cv::Mat buffers come from cv::fastMalloc, which operator new never sees.
+// While a MatAllocScope is alive, Mat buffers are counted as well, on the
+// thread that creates them. It swaps OpenCV's process-wide default
+// allocator, so open one only around a region under test.
+class MatAllocScope {
+public:
+    MatAllocScope();
+    ~MatAllocScope();
+    MatAllocScope(const MatAllocScope&) = delete;
+    MatAllocScope& operator=(const MatAllocScope&) = delete;
+
+private:
+    cv::MatAllocator* previous;
+};
+
+// Per-frame snapshots of the calling thread's counters. Call lap() once per
+// frame on the thread that runs it.
+class FrameAllocCounter {
+public:
+    FrameAllocCounter();
+
+    // Allocations since the previous lap (or construction); frames that made
+    // any of their own are tallied in allocatingFrames
+    AllocStats lap();
+
+    uint64_t frames = 0;
+    uint64_t allocatingFrames = 0;
+    uint64_t allocations = 0;   // ours, over all frames
+
+private:
+    AllocStats last;
+};
@@ -0,0 +1,53 @@
+#include "Avatar.hpp"
+#include "ThreadPool.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+
+// Head-pose smoothing
+static const float smoothAlpha = 0.1f;
+
+// Rigs with fewer spring joints than this simulate on the render thread;
+// handing them to the pool costs more than it saves.
+static const size_t parallelSpringJoints = 256;
+
+// Distance between neighbouring avatars (VRM units are meters)
+static const float avatarSpacing = 0.8f;
+
+AvatarInstance::AvatarInstance(std::shared_ptr<const Model> model, const glm::mat4& transform)
+  : transform(transform) {
+    setModel(std::move(model));
+}
+
+void AvatarInstance::setModel(std::shared_ptr<const Model> model) {
+    shared = std::move(model);
+    skelPose = std::make_unique<SkeletonPose>(shared->skeleton);
+    skelPose->updateWorld();
+    ThreadPool* pool = shared->springBones.jointCount() >= parallelSpringJoints
+                     ? &ThreadPool::shared() : nullptr;
+    springs = std::make_unique<SpringBoneSystem>(shared->skeleton, shared->springBones, pool);
+}
+
+void AvatarInstance::setHeadRotation(const glm::quat& worldRotation) {
+    head = glm::slerp(head, worldRotation, smoothAlpha);
+    headTracked = true;
+}
+
+size_t AvatarInstance::update(float dt) {
+    if (headTracked) {
+        // The tracked rotation is in world space; the skeleton lives in
+        // model space behind the avatar's placement
+        const glm::quat placement = glm::quat_cast(glm::mat3(transform));
+        skelPose->setModelSpaceRotation(shared->skeleton.headNode,
+                                        glm::conjugate(placement) * head * placement);
+    }
+    size_t recomputed = skelPose->updateWorld();
+    springs->update(dt, *skelPose);
+    recomputed += skelPose->updateWorld();
+    return recomputed;
+}
+
+glm::mat4 avatarSlot(size_t index, size_t count) {
+    float x = ((float)index - (float)(count - 1) * 0.5f) * avatarSpacing;
+    // Pre-rotate 180° so the avatar faces the camera
+    return glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(x, 0, 0)),
+                       glm::radians(180.0f), glm::vec3(0, 1, 0));
+}
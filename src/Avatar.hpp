@@ -0,0 +1,42 @@
+#pragma once
+#include <memory>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include "Renderer.hpp"
+#include "Skeleton.hpp"
+#include "SpringBone.hpp"
+
+// One avatar in a scene. The Model is shared with every other avatar showing
+// the same file; placement, pose, spring bones and tracked head rotation are
+// per avatar.
+class AvatarInstance {
+public:
+    AvatarInstance(std::shared_ptr<const Model> model, const glm::mat4& transform);
+
+    const std::shared_ptr<const Model>& model() const { return shared; }
+    // Switches to another model (e.g. a reloaded file) and resets the pose
+    void setModel(std::shared_ptr<const Model> model);
+
+    glm::mat4 transform;
+
+    // Tracked head rotation in world space; smoothed across frames
+    void setHeadRotation(const glm::quat& worldRotation);
+
+    // Poses the head, steps the spring bones and brings the world
+    // transforms up to date. Returns how many nodes were recomputed.
+    size_t update(float dt);
+
+    const SkeletonPose& pose() const { return *skelPose; }
+    InstanceState state() const { return {transform, skelPose.get()}; }
+
+private:
+    std::shared_ptr<const Model>      shared;
+    std::unique_ptr<SkeletonPose>     skelPose;
+    std::unique_ptr<SpringBoneSystem> springs;
+    glm::quat head{1, 0, 0, 0};
+    bool      headTracked = false;
+};
+
+// Placement of avatar `index` of `count`: side by side along x, turned to
+// face the camera
+glm::mat4 avatarSlot(size_t index, size_t count);
@@ -0,0 +1,72 @@
+#include "Cache.hpp"
+#include "Log.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+uint64_t hashBytes(const void* data, size_t size, uint64_t seed) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    uint64_t h = seed;
+    for (size_t i = 0; i < size; ++i) {
+        h ^= p[i];
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+std::string cacheName(const char* kind, uint64_t hash) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "-%016llx", (unsigned long long)hash);
+    return std::string(kind) + buf;
+}
+
+static bool cacheDisabled() {
+    const char* env = std::getenv("FREETUBER_NO_CACHE");
+    return env && *env && *env != '0';
+}
+
+static fs::path cacheDir() {
+    if (const char* xdg = std::getenv("XDG_CACHE_HOME"); xdg && *xdg)
+        return fs::path(xdg) / "freetuber";
+    if (const char* home = std::getenv("HOME"); home && *home)
+        return fs::path(home) / ".cache" / "freetuber";
+    return {};
+}
+
+bool cacheRead(const std::string& name, std::vector<unsigned char>& out) {
+    fs::path dir = cacheDir();
+    if (cacheDisabled() || dir.empty()) return false;
+    std::ifstream f(dir / name, std::ios::binary | std::ios::ate);
+    if (!f) return false;
+    std::streamsize size = f.tellg();
+    if (size <= 0) return false;
+    out.resize((size_t)size);
+    f.seekg(0);
+    return (bool)f.read(reinterpret_cast<char*>(out.data()), size);
+}
+
+bool cacheWrite(const std::string& name, const void* data, size_t size) {
+    fs::path dir = cacheDir();
+    if (cacheDisabled() || dir.empty()) return false;
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    fs::path tmp = dir / (name + ".tmp" + std::to_string(getpid()));
+    {
+        std::ofstream f(tmp, std::ios::binary | std::ios::trunc);
+        if (!f || !f.write(static_cast<const char*>(data), (std::streamsize)size)) {
+            FT_LOG(Warn, "Cache: failed to write {}", tmp.string());
+            fs::remove(tmp, ec);
+            return false;
+        }
+    }
+    fs::rename(tmp, dir / name, ec);
+    if (ec) {
+        fs::remove(tmp, ec);
+        return false;
+    }
+    return true;
+}
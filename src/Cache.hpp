@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// On-disk cache for data derived from a model at load time (generated
+// tangents, compressed textures, ...). Entries live in
+// $XDG_CACHE_HOME/freetuber (default ~/.cache/freetuber) and are named after
+// a hash of their inputs, so a changed model simply misses. Set
+// FREETUBER_NO_CACHE=1 to bypass it.
+
+constexpr uint64_t kHashSeed = 0xcbf29ce484222325ull;  // FNV-1a offset basis
+
+// FNV-1a, chainable through `seed`
+uint64_t hashBytes(const void* data, size_t size, uint64_t seed = kHashSeed);
+
+template <class T>
+uint64_t hashVector(const std::vector<T>& v, uint64_t seed = kHashSeed) {
+    return hashBytes(v.data(), v.size() * sizeof(T), seed);
+}
+
+// "<kind>-<16 hex digits>"
+std::string cacheName(const char* kind, uint64_t hash);
+
+bool cacheRead(const std::string& name, std::vector<unsigned char>& out);
+
+// Written to a temporary file and renamed, so concurrent readers never see
+// a partial entry.
+bool cacheWrite(const std::string& name, const void* data, size_t size);
@@ -0,0 +1,162 @@
+#include "DrawList.hpp"
+#include "Log.hpp"
+#include "Skinning.hpp"
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+// Not in the 3.3 core loader; fetched at runtime on 4.3+ contexts
+#ifndef GL_DRAW_INDIRECT_BUFFER
+#define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#endif
+typedef void (APIENTRYP PFNMULTIDRAWELEMENTSINDIRECT)(GLenum mode, GLenum type, const void* indirect,
+                                                      GLsizei drawcount, GLsizei stride);
+static PFNMULTIDRAWELEMENTSINDIRECT multiDrawElementsIndirect = nullptr;
+
+static constexpr size_t kTexelsPerDraw = 5;
+
+bool DrawList::enableIndirect(GLADloadproc load) {
+    if (GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 3))
+        multiDrawElementsIndirect = (PFNMULTIDRAWELEMENTSINDIRECT)load("glMultiDrawElementsIndirect");
+    FT_LOG(Info, "DrawList: GL {}.{}, {}", GLVersion.major, GLVersion.minor,
+           multiDrawElementsIndirect ? "glMultiDrawElementsIndirect"
+                                     : "glMultiDrawElementsBaseVertex");
+    return multiDrawElementsIndirect != nullptr;
+}
+
+DrawList::~DrawList() {
+    if (indirect) glDeleteBuffers(1, &indirect);
+}
+
+void DrawList::build(const Model& model) {
+    batches.clear();
+    counts.clear();
+    offsets.clear();
+    baseVertices.clear();
+    commands.clear();
+    instanceCount = 1;
+
+    // Group opaque and alpha-tested meshes by everything a draw binds, so
+    // each batch is one multi-draw. Blended meshes follow in their own
+    // batches, in file order (the loader puts them last), since they
+    // composite over whatever was drawn before them.
+    std::vector<size_t> order(model.meshes.size());
+    std::iota(order.begin(), order.end(), 0);
+    auto key = [&](size_t i) {
+        const Mesh& m = model.meshes[i];
+        return std::tie(m.blend, m.diffuseTex, m.diffuseSampler, m.normalTex, m.normalSampler);
+    };
+    auto blended = std::stable_partition(order.begin(), order.end(),
+                                         [&](size_t i) { return !model.meshes[i].blend; });
+    std::stable_sort(order.begin(), blended, [&](size_t a, size_t b) { return key(a) < key(b); });
+
+    commands.reserve(order.size());
+    for (size_t n = 0; n < order.size(); ++n) {
+        const Mesh& m = model.meshes[order[n]];
+        if (n == 0 || key(order[n]) != key(order[n - 1]))
+            batches.push_back({m.diffuseTex, m.diffuseSampler, m.normalTex, m.normalSampler,
+                               counts.size(), 0});
+        batches.back().count++;
+        counts.push_back((GLsizei)m.count);
+        offsets.push_back((const void*)(m.firstIndex * sizeof(uint32_t)));
+        baseVertices.push_back(m.baseVertex);
+        commands.push_back({(uint32_t)m.count, 1, m.firstIndex, m.baseVertex, 0});
+    }
+
+    if (multiDrawElementsIndirect) {
+        if (!indirect) glGenBuffers(1, &indirect);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER, commands.size() * sizeof(Command),
+                     commands.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+    // Texture binds per frame as draw() issues them, against one per mesh
+    // when every mesh was drawn on its own
+    size_t binds = 0;
+    for (size_t b = 0; b < batches.size(); ++b)
+        binds += b == 0 || batches[b].diffuseTex != batches[b - 1].diffuseTex;
+    FT_LOG(Info, "DrawList: {} meshes ({} blended) in {} multi-draw batches; {} texture binds "
+           "per frame (was {}, one per mesh)", model.meshes.size(), order.end() - blended,
+           batches.size(), binds, model.meshes.size());
+}
+
+void DrawList::update(const Model& model, const std::vector<InstanceState>& instances,
+                      const JointPalette& palette, StreamRing* ring) {
+    const size_t draws = model.meshes.size();
+    table.assign(instances.size() * draws * kTexelsPerDraw, glm::vec4(0.0f));
+    for (size_t i = 0; i < instances.size(); ++i) {
+        const glm::mat4&    modelMat = instances[i].model;
+        const SkeletonPose& pose     = *instances[i].pose;
+        glm::vec4* row = &table[i * draws * kTexelsPerDraw];
+        for (const Mesh& m : model.meshes) {
+            if (m.drawId >= draws) continue;
+            // Skinned meshes get their placement from the joints; rigid ones
+            // follow their node
+            glm::mat4 meshModel = modelMat;
+            if (m.skin < 0 && m.node >= 0) meshModel = modelMat * pose.world(m.node);
+            glm::vec4* t = &row[m.drawId * kTexelsPerDraw];
+            for (int c = 0; c < 4; ++c) t[c] = meshModel[c];
+            t[4] = glm::vec4(m.skin >= 0 ? 1.0f : 0.0f, (float)palette.offset(i, m.skin),
+                             (float)m.diffuseLayer, m.normalTex ? 1.0f : 0.0f);
+        }
+    }
+    if (table.empty()) table.push_back(glm::vec4(0.0f));  // keep the buffer valid
+
+    tableTexels.upload(table.data(), table.size() * sizeof(glm::vec4), ring);
+
+    // The recorded commands only change when the number of copies does
+    if (instances.size() != instanceCount) {
+        instanceCount = (uint32_t)instances.size();
+        for (Command& c : commands) c.instanceCount = instanceCount;
+        if (indirect && !commands.empty()) {
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect);
+            glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0, commands.size() * sizeof(Command),
+                            commands.data());
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        }
+    }
+}
+
+void DrawList::draw(GLuint vao, GLenum tableUnit) const {
+    if (batches.empty() || instanceCount == 0) return;
+    tableTexels.bind(tableUnit);
+    glBindVertexArray(vao);
+    if (multiDrawElementsIndirect) glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirect);
+
+    // Batches are grouped, so only changed state is rebound
+    const Batch* prev = nullptr;
+    for (const Batch& b : batches) {
+        if (!prev || b.diffuseTex != prev->diffuseTex) {
+            glActiveTexture(GL_TEXTURE0);
+            glBindTexture(GL_TEXTURE_2D_ARRAY, b.diffuseTex);
+        }
+        if (!prev || b.diffuseSampler != prev->diffuseSampler) glBindSampler(0, b.diffuseSampler);
+        if (b.normalTex && (!prev || b.normalTex != prev->normalTex)) {
+            glActiveTexture(GL_TEXTURE2);
+            glBindTexture(GL_TEXTURE_2D, b.normalTex);
+        }
+        if (b.normalTex && (!prev || b.normalSampler != prev->normalSampler))
+            glBindSampler(2, b.normalSampler);
+        prev = &b;
+
+        if (multiDrawElementsIndirect) {
+            multiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT,
+                                      (const void*)(b.first * sizeof(Command)),
+                                      (GLsizei)b.count, 0);
+        } else if (instanceCount > 1) {
+            // 3.3 has no instanced multi-draw: one call per mesh for all copies
+            for (size_t d = b.first; d < b.first + b.count; ++d)
+                glDrawElementsInstancedBaseVertex(GL_TRIANGLES, counts[d], GL_UNSIGNED_INT,
+                                                  offsets[d], (GLsizei)instanceCount,
+                                                  baseVertices[d]);
+        } else {
+            glMultiDrawElementsBaseVertex(GL_TRIANGLES, &counts[b.first], GL_UNSIGNED_INT,
+                                          &offsets[b.first], (GLsizei)b.count,
+                                          &baseVertices[b.first]);
+        }
+    }
+
+    if (multiDrawElementsIndirect) glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    glBindVertexArray(0);
+    glActiveTexture(GL_TEXTURE0);
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include "VRMLoader.hpp"
+#include "Renderer.hpp"
+#include "StreamRing.hpp"
+
+class JointPalette;
+
+// The model's draw calls, recorded once after upload and replayed every
+// frame. Meshes sharing textures and samplers form one batch, drawn with a
+// single glMultiDrawElementsIndirect (GL 4.3+) or glMultiDrawElementsBaseVertex.
+// Alpha-blended meshes are batched last and keep their file order.
+//
+// Per-mesh state that used to be uniforms (model matrix, skinning, layer) is
+// in a buffer texture (uDrawTable) indexed by the vertex draw id, since GL 3.3
+// has no gl_DrawID. Several instances of the model are drawn by the same
+// calls; each has its own run of the table, selected by gl_InstanceID.
+class DrawList {
+public:
+    DrawList() = default;
+    ~DrawList();
+    DrawList(const DrawList&) = delete;
+    DrawList& operator=(const DrawList&) = delete;
+
+    // Loads the indirect entry point when the context is 4.3+; call once
+    // after gladLoadGLLoader. Returns whether the indirect path is used.
+    static bool enableIndirect(GLADloadproc load);
+
+    // GL thread, after upload and whenever the model is replaced
+    void build(const Model& model);
+
+    // GL thread, once per frame after the poses are final. Every instance
+    // needs a pose; `palette` holds their joints in the same order.
+    void update(const Model& model, const std::vector<InstanceState>& instances,
+                const JointPalette& palette, StreamRing* ring = nullptr);
+
+    // Base color on unit 0, normal map on unit 2, draw table on `tableUnit`
+    void draw(GLuint vao, GLenum tableUnit) const;
+
+    size_t batchCount() const { return batches.size(); }
+    // Table rows per instance (uDrawsPerInstance)
+    size_t drawsPerInstance() const { return counts.size(); }
+
+private:
+    struct Batch {
+        GLuint diffuseTex, diffuseSampler, normalTex, normalSampler;
+        size_t first, count;   // range in counts/offsets/baseVertices/commands
+    };
+    // Layout fixed by glMultiDrawElementsIndirect
+    struct Command {
+        uint32_t count, instanceCount, firstIndex;
+        int32_t  baseVertex;
+        uint32_t baseInstance;
+    };
+
+    std::vector<Batch>       batches;
+    std::vector<GLsizei>     counts;
+    std::vector<const void*> offsets;
+    std::vector<GLint>       baseVertices;
+    std::vector<Command>     commands;
+    GLuint indirect = 0;
+    uint32_t instanceCount = 1;
+
+    std::vector<glm::vec4> table;   // 5 texels per draw id and instance
+    StreamedTexels tableTexels;
+};
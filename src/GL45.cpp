@@ -0,0 +1,33 @@
+#include "GL45.hpp"
+#include "Log.hpp"
+
+GL45Api gl45{};
+
+template <class Fn>
+static bool resolve(GLADloadproc load, const char* name, Fn& fn) {
+    fn = (Fn)load(name);
+    if (!fn) FT_LOG(Warn, "GL45: {} missing", name);
+    return fn != nullptr;
+}
+
+bool loadGL45(GLADloadproc load) {
+    gl45 = GL45Api{};
+    if (GLVersion.major < 4 || (GLVersion.major == 4 && GLVersion.minor < 5)) return false;
+
+    GL45Api api{};
+    bool ok = resolve(load, "glCreateBuffers", api.createBuffers)
+            & resolve(load, "glNamedBufferStorage", api.namedBufferStorage)
+            & resolve(load, "glNamedBufferSubData", api.namedBufferSubData)
+            & resolve(load, "glMapNamedBufferRange", api.mapNamedBufferRange)
+            & resolve(load, "glCreateVertexArrays", api.createVertexArrays)
+            & resolve(load, "glVertexArrayVertexBuffer", api.vertexArrayVertexBuffer)
+            & resolve(load, "glVertexArrayElementBuffer", api.vertexArrayElementBuffer)
+            & resolve(load, "glEnableVertexArrayAttrib", api.enableVertexArrayAttrib)
+            & resolve(load, "glVertexArrayAttribFormat", api.vertexArrayAttribFormat)
+            & resolve(load, "glVertexArrayAttribIFormat", api.vertexArrayAttribIFormat)
+            & resolve(load, "glVertexArrayAttribBinding", api.vertexArrayAttribBinding)
+            & resolve(load, "glCreateTextures", api.createTextures)
+            & resolve(load, "glTextureBufferRange", api.textureBufferRange);
+    if (ok) gl45 = api;
+    return ok;
+}
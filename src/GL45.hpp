@@ -0,0 +1,46 @@
+#pragma once
+#include <glad/glad.h>
+
+// GL 4.5 entry points the bundled 3.3 core loader does not provide: direct
+// state access and immutable buffer storage. Loaded at runtime; everything
+// stays null on older contexts and callers keep the 3.3 path.
+
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT   0x0080
+#define GL_DYNAMIC_STORAGE_BIT 0x0100
+#endif
+#ifndef GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT
+#define GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT 0x919F
+#endif
+
+struct GL45Api {
+    void  (APIENTRYP createBuffers)(GLsizei n, GLuint* buffers);
+    void  (APIENTRYP namedBufferStorage)(GLuint buffer, GLsizeiptr size, const void* data,
+                                         GLbitfield flags);
+    void  (APIENTRYP namedBufferSubData)(GLuint buffer, GLintptr offset, GLsizeiptr size,
+                                         const void* data);
+    void* (APIENTRYP mapNamedBufferRange)(GLuint buffer, GLintptr offset, GLsizeiptr length,
+                                          GLbitfield access);
+    void  (APIENTRYP createVertexArrays)(GLsizei n, GLuint* arrays);
+    void  (APIENTRYP vertexArrayVertexBuffer)(GLuint vao, GLuint binding, GLuint buffer,
+                                              GLintptr offset, GLsizei stride);
+    void  (APIENTRYP vertexArrayElementBuffer)(GLuint vao, GLuint buffer);
+    void  (APIENTRYP enableVertexArrayAttrib)(GLuint vao, GLuint index);
+    void  (APIENTRYP vertexArrayAttribFormat)(GLuint vao, GLuint index, GLint size, GLenum type,
+                                              GLboolean normalized, GLuint relativeOffset);
+    void  (APIENTRYP vertexArrayAttribIFormat)(GLuint vao, GLuint index, GLint size, GLenum type,
+                                               GLuint relativeOffset);
+    void  (APIENTRYP vertexArrayAttribBinding)(GLuint vao, GLuint index, GLuint binding);
+    void  (APIENTRYP createTextures)(GLenum target, GLsizei n, GLuint* textures);
+    void  (APIENTRYP textureBufferRange)(GLuint texture, GLenum internalFormat, GLuint buffer,
+                                         GLintptr offset, GLsizeiptr size);
+};
+
+extern GL45Api gl45;
+
+// Call once after gladLoadGLLoader. Returns true (and fills gl45) only on a
+// 4.5+ context where every entry point resolved.
+bool loadGL45(GLADloadproc load);
+
+inline bool haveGL45() { return gl45.createBuffers != nullptr; }
@@ -0,0 +1,160 @@
+#include "GLRenderer.hpp"
+#include "GL45.hpp"
+#include "ModelLibrary.hpp"
+#include "Log.hpp"
+#include "Shader.hpp"
+#include "EmbeddedResources.hpp"
+#include <algorithm>
+#include <chrono>
+
+GLRenderer::GLRenderer(GLADloadproc load, bool allowGL45) {
+    useDsa = allowGL45 && loadGL45(load);
+    if (allowGL45) DrawList::enableIndirect(load);
+    FT_LOG(Info, "Renderer: GL {}.{}, {} path", GLVersion.major, GLVersion.minor,
+           useDsa ? "4.5 (DSA, persistent-mapped ring)" : "3.3");
+    // Per-frame joint palette + draw table; frames that need more fall back
+    // to glBufferSubData
+    if (useDsa) {
+        ring = std::make_unique<StreamRing>(1u << 20);
+        if (!ring->valid()) ring.reset();
+    }
+
+    glDisable(GL_CULL_FACE);
+    // Enable blending for transparency
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    // Load shaders from embedded strings
+    program = loadShaderProgramFromSource(vertexShaderSrc, fragmentShaderSrc);
+    if (!program) return;
+    glUseProgram(program);
+    locView     = glGetUniformLocation(program, "uView");
+    locProj     = glGetUniformLocation(program, "uProj");
+    locLightDir = glGetUniformLocation(program, "uLightDir");
+    locAmbient  = glGetUniformLocation(program, "uAmbient");
+    locDrawsPerInstance = glGetUniformLocation(program, "uDrawsPerInstance");
+
+    // Base color on unit 0, joint palette on unit 1, normal map on unit 2,
+    // per-draw table on unit 3
+    glUniform1i(glGetUniformLocation(program, "uBaseColorTexture"), 0);
+    glUniform1i(glGetUniformLocation(program, "uJointMats"),         1);
+    glUniform1i(glGetUniformLocation(program, "uNormalTexture"),     2);
+    glUniform1i(glGetUniformLocation(program, "uDrawTable"),         3);
+}
+
+GLRenderer::~GLRenderer() {
+    batches.clear();
+    uploaded.reset();
+    if (program) glDeleteProgram(program);
+}
+
+bool GLRenderer::upload(VRMData data) {
+    Model model;
+    uploadVRM(std::move(data), model);
+    uploaded = shareModel(std::move(model));
+    return true;
+}
+
+GLRenderer::ModelBatch& GLRenderer::batchFor(const std::shared_ptr<const Model>& model) {
+    auto& slot = batches[model->id];
+    if (!slot) {
+        slot = std::make_unique<ModelBatch>();
+        slot->model    = model;
+        slot->bindPose = std::make_unique<SkeletonPose>(model->skeleton);
+        slot->bindPose->updateWorld();
+        slot->drawList.build(*model);
+    }
+    if (slot->lastFrame != frameCount) {
+        slot->lastFrame = frameCount;
+        drawOrder.push_back(slot.get());
+    }
+    return *slot;
+}
+
+void GLRenderer::resize(int width, int height) {
+    viewportW = width;
+    viewportH = height;
+    glViewport(0, 0, width, height);
+}
+
+void GLRenderer::drawFrame(const FrameState& frame) {
+    ++frameCount;
+    if (uploaded) batchFor(uploaded).instances = frame.instances;
+    submit(frame);
+}
+
+void GLRenderer::drawAvatars(const FrameState& frame, const std::vector<AvatarInstance>& avatars) {
+    ++frameCount;
+    for (const AvatarInstance& a : avatars)
+        batchFor(a.model()).instances.push_back(a.state());
+    submit(frame);
+}
+
+void GLRenderer::submit(const FrameState& frame) {
+    auto tSubmit = std::chrono::steady_clock::now();
+
+    glUseProgram(program);
+    glUniformMatrix4fv(locView, 1, GL_FALSE, &frame.view[0][0]);
+    glUniformMatrix4fv(locProj, 1, GL_FALSE, &frame.proj[0][0]);
+    glUniform3fv(locLightDir, 1, &frame.lightDir[0]);
+    glUniform3fv(locAmbient,  1, &frame.ambient[0]);
+
+    // Models nobody showed last frame are dropped
+    for (auto it = batches.begin(); it != batches.end(); ) {
+        if (it->second->lastFrame != frameCount) it = batches.erase(it);
+        else ++it;
+    }
+
+    if (ring) ring->beginFrame();
+    for (ModelBatch* batch : drawOrder) {
+        poses.clear();
+        for (InstanceState& inst : batch->instances) {
+            if (!inst.pose) inst.pose = batch->bindPose.get();
+            poses.push_back(inst.pose);
+        }
+        batch->palette.upload(poses, ring.get());
+        batch->drawList.update(*batch->model, batch->instances, batch->palette, ring.get());
+    }
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glEnable(GL_DEPTH_TEST);
+
+    // Scene order, so blended meshes of different models overlap the same
+    // way every frame
+    for (ModelBatch* batch : drawOrder) {
+        batch->palette.bind(GL_TEXTURE1);
+        glUniform1i(locDrawsPerInstance, (GLint)batch->drawList.drawsPerInstance());
+        batch->drawList.draw(batch->model->vao, GL_TEXTURE3);
+        batch->instances.clear();
+    }
+    drawOrder.clear();
+    if (ring) ring->endFrame();
+
+    submitMs += std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - tSubmit).count();
+    if (++submitFrames == 300) {
+        FT_LOG(Info, "Renderer: {} path, CPU submit {} ms/frame (avg of {} frames)",
+               useDsa ? "4.5" : "3.3", submitMs / submitFrames, submitFrames);
+        submitMs = 0.0;
+        submitFrames = 0;
+    }
+}
+
+void GLRenderer::finish() {
+    glFinish();
+}
+
+bool GLRenderer::readPixels(std::vector<unsigned char>& rgba, int& width, int& height) {
+    if (viewportW <= 0 || viewportH <= 0) return false;
+    width  = viewportW;
+    height = viewportH;
+    rgba.resize((size_t)width * height * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, rgba.data());
+    // GL rows start at the bottom
+    const size_t row = (size_t)width * 4;
+    for (int y = 0; y < height / 2; ++y)
+        std::swap_ranges(rgba.begin() + y * row, rgba.begin() + (y + 1) * row,
+                         rgba.end() - (y + 1) * row);
+    return true;
+}
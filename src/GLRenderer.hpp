@@ -0,0 +1,60 @@
+#pragma once
+#include <unordered_map>
+#include "Renderer.hpp"
+#include "Avatar.hpp"
+#include "DrawList.hpp"
+#include "Skinning.hpp"
+#include "StreamRing.hpp"
+
+// OpenGL backend: 4.5 (DSA, persistent-mapped ring) when the context allows,
+// else 3.3. Needs a current context with glad loaded. All copies of one model
+// in a frame are drawn together, instanced.
+class GLRenderer : public Renderer {
+public:
+    GLRenderer(GLADloadproc load, bool allowGL45);
+    ~GLRenderer() override;
+
+    // False if the shaders failed to build
+    bool valid() const { return program != 0; }
+
+    const char* name() const override { return useDsa ? "gl45" : "gl33"; }
+    bool upload(VRMData data) override;
+    void resize(int width, int height) override;
+    void drawFrame(const FrameState& frame) override;
+    void finish() override;
+    bool readPixels(std::vector<unsigned char>& rgba, int& width, int& height) override;
+
+    // Draws a scene of avatars; the instances in `frame` are ignored.
+    // Avatars sharing a Model cost one set of draw calls.
+    void drawAvatars(const FrameState& frame, const std::vector<AvatarInstance>& avatars);
+
+private:
+    // Per-model draw state, kept while the model is on screen
+    struct ModelBatch {
+        std::shared_ptr<const Model>  model;
+        std::unique_ptr<SkeletonPose> bindPose;   // for instances without a pose
+        DrawList                      drawList;
+        JointPalette                  palette;
+        std::vector<InstanceState>    instances;  // this frame's copies
+        uint64_t                      lastFrame = 0;
+    };
+    ModelBatch& batchFor(const std::shared_ptr<const Model>& model);
+    void submit(const FrameState& frame);
+
+    GLuint program = 0;
+    GLint  locView = -1, locProj = -1, locLightDir = -1, locAmbient = -1;
+    GLint  locDrawsPerInstance = -1;
+    bool   useDsa = false;   // GL 4.5 path: DSA + persistent ring
+    int    viewportW = 0, viewportH = 0;
+
+    std::shared_ptr<const Model> uploaded;    // drawn by drawFrame()
+    std::unordered_map<uint64_t, std::unique_ptr<ModelBatch>> batches;   // by Model::id
+    std::vector<ModelBatch*> drawOrder;       // this frame's batches, in scene order
+    uint64_t frameCount = 0;
+    std::unique_ptr<StreamRing> ring;         // null on the 3.3 path
+    std::vector<const SkeletonPose*> poses;   // scratch
+
+    // CPU time spent issuing GL commands per frame (uploads + draws)
+    double submitMs = 0.0;
+    int    submitFrames = 0;
+};
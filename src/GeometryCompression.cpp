@@ -0,0 +1,279 @@
+#include "GeometryCompression.hpp"
+#include "ThreadPool.hpp"
+#include "Log.hpp"
+#include <tiny_gltf.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+#ifdef FT_HAVE_MESHOPT
+#include <meshoptimizer.h>
+#endif
+#ifdef FT_HAVE_DRACO
+#include <draco/compression/decode.h>
+#endif
+
+static const char* kMeshopt = "EXT_meshopt_compression";
+static const char* kDraco   = "KHR_draco_mesh_compression";
+
+static bool required(const tinygltf::Model& model, const char* ext) {
+    return std::find(model.extensionsRequired.begin(), model.extensionsRequired.end(), ext) !=
+           model.extensionsRequired.end();
+}
+
+#if defined(FT_HAVE_MESHOPT) || defined(FT_HAVE_DRACO)
+
+static const tinygltf::Value* member(const tinygltf::Value& obj, const char* key) {
+    return obj.IsObject() && obj.Has(key) ? &obj.Get(key) : nullptr;
+}
+
+static size_t sizeOr(const tinygltf::Value& obj, const char* key, size_t def) {
+    auto v = member(obj, key);
+    return v && v->IsNumber() && v->GetNumberAsDouble() >= 0 ? (size_t)v->GetNumberAsDouble() : def;
+}
+
+static std::string stringOr(const tinygltf::Value& obj, const char* key, const char* def) {
+    auto v = member(obj, key);
+    return v && v->IsString() ? v->Get<std::string>() : def;
+}
+
+// Encoded bytes of a (buffer, offset, length) range, or null if out of bounds
+static const unsigned char* sourceRange(const tinygltf::Model& model, int buffer,
+                                        size_t offset, size_t length) {
+    if (buffer < 0 || (size_t)buffer >= model.buffers.size()) return nullptr;
+    const auto& data = model.buffers[buffer].data;
+    if (offset > data.size() || data.size() - offset < length) return nullptr;
+    return data.data() + offset;
+}
+
+#endif
+
+// Appends a buffer holding `bytes` and returns its index
+static int addBuffer(tinygltf::Model& model, std::vector<unsigned char>&& bytes) {
+    tinygltf::Buffer b;
+    b.data = std::move(bytes);
+    model.buffers.push_back(std::move(b));
+    return (int)model.buffers.size() - 1;
+}
+
+// One independent stream; decoded on a worker, attached afterwards
+struct DecodeTask {
+    int  bufferView = -1;                  // meshopt: the view it replaces
+    int  mesh = -1, primitive = -1;        // draco: the primitive it feeds
+    std::vector<unsigned char> out;        // meshopt: the view's bytes
+    std::vector<std::vector<unsigned char>> attributes;  // draco, per accessor
+    std::vector<int> accessors;            // draco: accessor per attributes[i]
+    std::vector<uint32_t> indices;         // draco
+    bool ok = false;
+};
+
+#ifdef FT_HAVE_MESHOPT
+
+static void decodeMeshopt(const tinygltf::Model& model, DecodeTask& t, size_t& encoded) {
+    const auto& ext = model.bufferViews[t.bufferView].extensions.at(kMeshopt);
+    const size_t count  = sizeOr(ext, "count", 0);
+    const size_t stride = sizeOr(ext, "byteStride", 0);
+    const size_t length = sizeOr(ext, "byteLength", 0);
+    const auto* src = sourceRange(model, (int)sizeOr(ext, "buffer", SIZE_MAX),
+                                  sizeOr(ext, "byteOffset", 0), length);
+    encoded = length;
+    if (!src || !count || !stride || stride > 256) return;
+
+    const std::string mode   = stringOr(ext, "mode", "");
+    const std::string filter = stringOr(ext, "filter", "NONE");
+    t.out.resize(count * stride);
+    int rc = -1;
+    if (mode == "ATTRIBUTES") {
+        rc = meshopt_decodeVertexBuffer(t.out.data(), count, stride, src, length);
+    } else if (mode == "TRIANGLES") {
+        rc = meshopt_decodeIndexBuffer(t.out.data(), count, stride, src, length);
+    } else if (mode == "INDICES") {
+        rc = meshopt_decodeIndexSequence(t.out.data(), count, stride, src, length);
+    }
+    if (rc != 0) return;
+
+    if (filter == "OCTAHEDRAL") {
+        meshopt_decodeFilterOct(t.out.data(), count, stride);
+    } else if (filter == "QUATERNION") {
+        meshopt_decodeFilterQuat(t.out.data(), count, stride);
+    } else if (filter == "EXPONENTIAL") {
+        meshopt_decodeFilterExp(t.out.data(), count, stride);
+    } else if (filter != "NONE") {
+        return;
+    }
+    t.ok = true;
+}
+
+#endif
+
+#ifdef FT_HAVE_DRACO
+
+static void decodeDraco(const tinygltf::Model& model, DecodeTask& t, size_t& encoded) {
+    const auto& prim = model.meshes[t.mesh].primitives[t.primitive];
+    const auto& ext  = prim.extensions.at(kDraco);
+    const size_t viewIdx = sizeOr(ext, "bufferView", SIZE_MAX);
+    if (viewIdx >= model.bufferViews.size()) return;
+    const auto& view = model.bufferViews[viewIdx];
+    const auto* src = sourceRange(model, view.buffer, view.byteOffset, view.byteLength);
+    encoded = view.byteLength;
+    auto attrs = member(ext, "attributes");
+    if (!src || !attrs) return;
+
+    draco::DecoderBuffer buf;
+    buf.Init(reinterpret_cast<const char*>(src), view.byteLength);
+    draco::Decoder decoder;
+    auto decoded = decoder.DecodeMeshFromBuffer(&buf);
+    if (!decoded.ok()) return;
+    const draco::Mesh& mesh = *decoded.value();
+
+    t.indices.resize(mesh.num_faces() * 3);
+    for (draco::FaceIndex f(0); f < mesh.num_faces(); ++f)
+        for (int c = 0; c < 3; ++c)
+            t.indices[f.value() * 3 + c] = mesh.face(f)[c].value();
+
+    // The glTF accessors keep their component type; draco stores the same
+    // type, so values are copied through unchanged
+    for (const auto& name : attrs->Keys()) {
+        auto it = prim.attributes.find(name);
+        if (it == prim.attributes.end()) continue;
+        const auto& acc = model.accessors[it->second];
+        const auto* attr = mesh.GetAttributeByUniqueId(
+            (uint32_t)attrs->Get(name).GetNumberAsInt());
+        const size_t elemSize = (size_t)tinygltf::GetComponentSizeInBytes(acc.componentType) *
+                                tinygltf::GetNumComponentsInType(acc.type);
+        if (!attr || acc.count != mesh.num_points() || (size_t)attr->byte_stride() != elemSize)
+            return;
+
+        std::vector<unsigned char> out(acc.count * elemSize);
+        for (draco::PointIndex p(0); p < mesh.num_points(); ++p)
+            attr->GetValue(attr->mapped_index(p), out.data() + p.value() * elemSize);
+        t.attributes.push_back(std::move(out));
+        t.accessors.push_back(it->second);
+    }
+    t.ok = true;
+}
+
+#endif
+
+bool decompressGeometry(tinygltf::Model& model, GeometryDecodeStats& stats) {
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<DecodeTask> tasks;
+    bool meshopt = false, draco = false;
+
+    for (size_t i = 0; i < model.bufferViews.size(); ++i) {
+        if (!model.bufferViews[i].extensions.count(kMeshopt)) continue;
+        meshopt = true;
+        DecodeTask t;
+        t.bufferView = (int)i;
+        tasks.push_back(std::move(t));
+    }
+    for (size_t m = 0; m < model.meshes.size(); ++m) {
+        const auto& prims = model.meshes[m].primitives;
+        for (size_t p = 0; p < prims.size(); ++p) {
+            if (!prims[p].extensions.count(kDraco)) continue;
+            draco = true;
+            DecodeTask t;
+            t.mesh = (int)m;
+            t.primitive = (int)p;
+            tasks.push_back(std::move(t));
+        }
+    }
+    if (tasks.empty()) return true;
+
+    // Without a decoder, files that carry uncompressed fallback data still load
+#ifndef FT_HAVE_MESHOPT
+    if (meshopt && required(model, kMeshopt)) {
+        FT_LOG(Error, "loadVRM: built without meshoptimizer, cannot decode {}", kMeshopt);
+        return false;
+    }
+#endif
+#ifndef FT_HAVE_DRACO
+    if (draco && required(model, kDraco)) {
+        FT_LOG(Error, "loadVRM: built without draco, cannot decode {}", kDraco);
+        return false;
+    }
+#endif
+    (void)meshopt; (void)draco;
+
+    std::vector<size_t> encoded(tasks.size(), 0);
+    ThreadPool::loaders().parallelFor(tasks.size(), [&](size_t i) {
+        DecodeTask& t = tasks[i];
+#ifdef FT_HAVE_MESHOPT
+        if (t.bufferView >= 0) decodeMeshopt(model, t, encoded[i]);
+#endif
+#ifdef FT_HAVE_DRACO
+        if (t.mesh >= 0) decodeDraco(model, t, encoded[i]);
+#endif
+        (void)t;
+    });
+
+    // Point the views and accessors at the decoded data (single-threaded:
+    // this grows model.buffers)
+    bool ok = true;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        DecodeTask& t = tasks[i];
+        if (!t.ok) {
+            // Uncompressed fallback data, if any, stays in place
+            bool needed = t.bufferView >= 0 ? required(model, kMeshopt) : required(model, kDraco);
+            if (needed) {
+                FT_LOG(Error, "loadVRM: failed to decode {} stream {}",
+                       t.bufferView >= 0 ? kMeshopt : kDraco, i);
+                ok = false;
+            }
+            continue;
+        }
+        stats.compressedBytes += encoded[i];
+        if (t.bufferView >= 0) {
+            stats.decompressedBytes += t.out.size();
+            ++stats.bufferViews;
+            size_t size = t.out.size();
+            int buffer = addBuffer(model, std::move(t.out));
+            auto& view = model.bufferViews[t.bufferView];
+            view.buffer     = buffer;
+            view.byteOffset = 0;
+            view.byteLength = size;
+            view.extensions.erase(kMeshopt);
+            continue;
+        }
+
+        ++stats.dracoMeshes;
+        auto attach = [&](int accessor, std::vector<unsigned char>&& bytes) {
+            tinygltf::BufferView view;
+            view.byteLength = bytes.size();
+            stats.decompressedBytes += bytes.size();
+            view.buffer = addBuffer(model, std::move(bytes));
+            model.bufferViews.push_back(view);
+            auto& acc = model.accessors[accessor];
+            acc.bufferView = (int)model.bufferViews.size() - 1;
+            acc.byteOffset = 0;
+        };
+        for (size_t a = 0; a < t.accessors.size(); ++a)
+            attach(t.accessors[a], std::move(t.attributes[a]));
+
+        auto& prim = model.meshes[t.mesh].primitives[t.primitive];
+        if (prim.indices >= 0) {
+            // Draco hands out u32; the accessor is widened to match
+            auto& acc = model.accessors[prim.indices];
+            acc.componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT;
+            acc.count = t.indices.size();
+            std::vector<unsigned char> bytes(t.indices.size() * sizeof(uint32_t));
+            std::memcpy(bytes.data(), t.indices.data(), bytes.size());
+            attach(prim.indices, std::move(bytes));
+        }
+        prim.extensions.erase(kDraco);
+    }
+
+    stats.ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - t0).count();
+    if (stats.compressedBytes) {
+        FT_LOG(Info, "loadVRM: decoded {} meshopt views and {} draco meshes in {} ms: "
+               "{} KB -> {} KB ({}% saved)",
+               stats.bufferViews, stats.dracoMeshes, stats.ms,
+               stats.compressedBytes / 1024, stats.decompressedBytes / 1024,
+               100.0 * (1.0 - (double)stats.compressedBytes /
+                              std::max<size_t>(stats.decompressedBytes, 1)));
+    }
+    return ok;
+}
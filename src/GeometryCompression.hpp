@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+
+namespace tinygltf { class Model; }
+
+struct GeometryDecodeStats {
+    size_t compressedBytes   = 0;   // encoded bytes read
+    size_t decompressedBytes = 0;   // raw bytes produced
+    size_t bufferViews       = 0;   // EXT_meshopt_compression views decoded
+    size_t dracoMeshes       = 0;   // KHR_draco_mesh_compression streams decoded
+    double ms                = 0;
+};
+
+// Decodes EXT_meshopt_compression buffer views and KHR_draco_mesh_compression
+// primitives in place, spreading the streams over ThreadPool::loaders().
+// Afterwards every accessor points at plain data, so the accessor stage
+// needs no knowledge of either extension.
+//
+// Each decoder is only compiled in when its library was found at configure
+// time (FT_HAVE_MESHOPT, FT_HAVE_DRACO). Returns false if the model requires
+// an extension this build cannot decode or a stream is corrupt.
+bool decompressGeometry(tinygltf::Model& model, GeometryDecodeStats& stats);
@@ -0,0 +1,435 @@
+#include "GltfAccessor.hpp"
+#include "Log.hpp"
+#include <tiny_gltf.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+static int componentSize(int type) {
+    switch (type) {
+        case TINYGLTF_COMPONENT_TYPE_BYTE:
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:  return 1;
+        case TINYGLTF_COMPONENT_TYPE_SHORT:
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: return 2;
+        case TINYGLTF_COMPONENT_TYPE_INT:
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+        case TINYGLTF_COMPONENT_TYPE_FLOAT:          return 4;
+        default:                                     return 0;
+    }
+}
+
+static int componentCount(int type) {
+    switch (type) {
+        case TINYGLTF_TYPE_SCALAR: return 1;
+        case TINYGLTF_TYPE_VEC2:   return 2;
+        case TINYGLTF_TYPE_VEC3:   return 3;
+        case TINYGLTF_TYPE_VEC4:   return 4;
+        case TINYGLTF_TYPE_MAT2:   return 4;
+        case TINYGLTF_TYPE_MAT3:   return 9;
+        case TINYGLTF_TYPE_MAT4:   return 16;
+        default:                   return 0;
+    }
+}
+
+// Resolves bufferView + offset into a pointer, checking `bytes` fit
+static const unsigned char* bufferRange(const tinygltf::Model& model, int viewIdx,
+                                        size_t offset, size_t bytes,
+                                        const unsigned char** end) {
+    if (viewIdx < 0 || viewIdx >= (int)model.bufferViews.size()) return nullptr;
+    const auto& view = model.bufferViews[viewIdx];
+    if (view.buffer < 0 || view.buffer >= (int)model.buffers.size()) return nullptr;
+    const auto& buf = model.buffers[view.buffer].data;
+    if (view.byteOffset + offset + bytes > buf.size() ||
+        offset + bytes > view.byteLength) return nullptr;
+    if (end) *end = buf.data() + buf.size();
+    return buf.data() + view.byteOffset + offset;
+}
+
+bool makeAccessorView(const tinygltf::Model& model, int accessor, AccessorView& out) {
+    out = AccessorView();
+    if (accessor < 0 || accessor >= (int)model.accessors.size()) return false;
+    const auto& acc = model.accessors[accessor];
+
+    const int csize = componentSize(acc.componentType);
+    const int comps = componentCount(acc.type);
+    if (!csize || !comps || acc.count == 0) return false;
+    const size_t elemSize = (size_t)csize * comps;
+
+    AccessorView v;
+    v.count         = acc.count;
+    v.componentType = acc.componentType;
+    v.components    = comps;
+    v.normalized    = acc.normalized;
+    v.stride        = elemSize;
+
+    if (acc.bufferView >= 0) {
+        const auto& view = model.bufferViews[acc.bufferView];
+        if (view.byteStride) v.stride = view.byteStride;
+        if (v.stride < elemSize) return false;
+        size_t bytes = (acc.count - 1) * v.stride + elemSize;
+        v.data = bufferRange(model, acc.bufferView, acc.byteOffset, bytes, &v.end);
+        if (!v.data) return false;
+    }
+    // else: all elements start out as zero (sparse-only accessor)
+
+    if (acc.sparse.isSparse && acc.sparse.count > 0) {
+        const auto& sp = acc.sparse;
+        const size_t n = (size_t)sp.count;
+        const int isize = componentSize(sp.indices.componentType);
+        const unsigned char* idx = bufferRange(model, sp.indices.bufferView,
+                                               sp.indices.byteOffset, n * isize, nullptr);
+        v.sparseValues = bufferRange(model, sp.values.bufferView,
+                                     sp.values.byteOffset, n * elemSize, nullptr);
+        if (!idx || !v.sparseValues || !isize) return false;
+        v.sparseIndices.resize(n);
+        for (size_t k = 0; k < n; ++k) {
+            uint32_t i = 0;
+            if (isize == 1)      i = idx[k];
+            else if (isize == 2) { uint16_t u; std::memcpy(&u, idx + k * 2, 2); i = u; }
+            else                 std::memcpy(&i, idx + k * 4, 4);
+            if (i >= acc.count) return false;
+            v.sparseIndices[k] = i;
+        }
+    }
+
+    out = std::move(v);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Scalar conversion
+
+static float readComponent(const unsigned char* p, int type, bool normalized) {
+    switch (type) {
+        case TINYGLTF_COMPONENT_TYPE_FLOAT: {
+            float f; std::memcpy(&f, p, 4); return f;
+        }
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+            return normalized ? p[0] / 255.0f : (float)p[0];
+        case TINYGLTF_COMPONENT_TYPE_BYTE: {
+            int8_t c = (int8_t)p[0];
+            return normalized ? std::max(c / 127.0f, -1.0f) : (float)c;
+        }
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
+            uint16_t c; std::memcpy(&c, p, 2);
+            return normalized ? c / 65535.0f : (float)c;
+        }
+        case TINYGLTF_COMPONENT_TYPE_SHORT: {
+            int16_t c; std::memcpy(&c, p, 2);
+            return normalized ? std::max(c / 32767.0f, -1.0f) : (float)c;
+        }
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT: {
+            uint32_t c; std::memcpy(&c, p, 4); return (float)c;
+        }
+        case TINYGLTF_COMPONENT_TYPE_INT: {
+            int32_t c; std::memcpy(&c, p, 4); return (float)c;
+        }
+        default: return 0.0f;
+    }
+}
+
+static void convertElement(const AccessorView& v, const unsigned char* s, float* d, int dc) {
+    const int csize = componentSize(v.componentType);
+    const int n = s ? std::min(dc, v.components) : 0;
+    for (int c = 0; c < n; ++c)
+        d[c] = readComponent(s + c * csize, v.componentType, v.normalized);
+    for (int c = n; c < dc; ++c) d[c] = 0.0f;
+}
+
+// ---------------------------------------------------------------------------
+// SSE2 conversion: every element is loaded as one 4-lane vector, scaled, and
+// stored with as many lanes as the destination wants.
+
+#ifdef __SSE2__
+template <int Type>
+static inline __m128 loadElement(const unsigned char* p) {
+    const __m128i zero = _mm_setzero_si128();
+    if constexpr (Type == TINYGLTF_COMPONENT_TYPE_FLOAT) {
+        return _mm_loadu_ps(reinterpret_cast<const float*>(p));
+    } else if constexpr (Type == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE) {
+        int32_t w; std::memcpy(&w, p, 4);
+        __m128i x = _mm_cvtsi32_si128(w);
+        x = _mm_unpacklo_epi16(_mm_unpacklo_epi8(x, zero), zero);
+        return _mm_cvtepi32_ps(x);
+    } else if constexpr (Type == TINYGLTF_COMPONENT_TYPE_BYTE) {
+        int32_t w; std::memcpy(&w, p, 4);
+        __m128i x = _mm_cvtsi32_si128(w);
+        x = _mm_unpacklo_epi8(x, x);
+        x = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 24);
+        return _mm_cvtepi32_ps(x);
+    } else if constexpr (Type == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
+        __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+        return _mm_cvtepi32_ps(_mm_unpacklo_epi16(x, zero));
+    } else if constexpr (Type == TINYGLTF_COMPONENT_TYPE_SHORT) {
+        __m128i x = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+        return _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+    } else {  // INT
+        return _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+}
+
+template <int Type>
+static constexpr size_t loadBytes() {
+    if constexpr (Type == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE ||
+                  Type == TINYGLTF_COMPONENT_TYPE_BYTE) return 4;
+    else if constexpr (Type == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT ||
+                       Type == TINYGLTF_COMPONENT_TYPE_SHORT) return 8;
+    else return 16;
+}
+
+static inline void storeLanes(float* d, __m128 x, int n) {
+    switch (n) {
+        case 4: _mm_storeu_ps(d, x); break;
+        case 3: _mm_storel_pi(reinterpret_cast<__m64*>(d), x);
+                _mm_store_ss(d + 2, _mm_movehl_ps(x, x)); break;
+        case 2: _mm_storel_pi(reinterpret_cast<__m64*>(d), x); break;
+        case 1: _mm_store_ss(d, x); break;
+    }
+}
+
+// Returns the number of elements converted; the caller finishes the rest
+// (the last few elements, whose 4-lane load could run past the buffer).
+template <int Type>
+static size_t convertSimd(const AccessorView& v, float* dst, size_t dstStride, int dc,
+                          __m128* bmin, __m128* bmax) {
+    size_t safe = 0;
+    if ((size_t)(v.end - v.data) >= loadBytes<Type>())
+        safe = std::min(v.count, (size_t)(v.end - v.data - loadBytes<Type>()) / v.stride + 1);
+
+    __m128 scale = _mm_set1_ps(1.0f);
+    if (v.normalized) {
+        if constexpr (Type == TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE)  scale = _mm_set1_ps(1.0f / 255.0f);
+        if constexpr (Type == TINYGLTF_COMPONENT_TYPE_BYTE)           scale = _mm_set1_ps(1.0f / 127.0f);
+        if constexpr (Type == TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) scale = _mm_set1_ps(1.0f / 65535.0f);
+        if constexpr (Type == TINYGLTF_COMPONENT_TYPE_SHORT)          scale = _mm_set1_ps(1.0f / 32767.0f);
+    }
+    const bool clampSigned = v.normalized &&
+        (Type == TINYGLTF_COMPONENT_TYPE_BYTE || Type == TINYGLTF_COMPONENT_TYPE_SHORT);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    // Lanes the source doesn't have are zeroed
+    alignas(16) static const uint32_t laneMasks[5][4] = {
+        {0, 0, 0, 0}, {~0u, 0, 0, 0}, {~0u, ~0u, 0, 0}, {~0u, ~0u, ~0u, 0}, {~0u, ~0u, ~0u, ~0u}};
+    const __m128 keep = _mm_load_ps(reinterpret_cast<const float*>(laneMasks[std::min(v.components, 4)]));
+
+    const unsigned char* src = v.data;
+    float* d = dst;
+    __m128 lo = *bmin, hi = *bmax;
+    for (size_t i = 0; i < safe; ++i, src += v.stride, d += dstStride) {
+        __m128 x = _mm_mul_ps(loadElement<Type>(src), scale);
+        if (clampSigned) x = _mm_max_ps(x, minusOne);
+        x = _mm_and_ps(x, keep);
+        storeLanes(d, x, dc);
+        lo = _mm_min_ps(lo, x);
+        hi = _mm_max_ps(hi, x);
+    }
+    *bmin = lo;
+    *bmax = hi;
+    return safe;
+}
+#endif
+
+// `simd` false forces the scalar path, for the benchmark
+static void readFloats(const AccessorView& v, float* dst, size_t dstStride,
+                       int dc, AABB* bounds, bool simd) {
+    if (!v.valid() || dc <= 0) return;
+    size_t done = 0;
+    AABB b;
+
+#ifdef __SSE2__
+    // The 4-lane kernels handle up to four destination components
+    if (simd && v.data && dc <= 4) {
+        __m128 lo = _mm_set1_ps(1e30f), hi = _mm_set1_ps(-1e30f);
+        switch (v.componentType) {
+            case TINYGLTF_COMPONENT_TYPE_FLOAT:
+                done = convertSimd<TINYGLTF_COMPONENT_TYPE_FLOAT>(v, dst, dstStride, dc, &lo, &hi); break;
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+                done = convertSimd<TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE>(v, dst, dstStride, dc, &lo, &hi); break;
+            case TINYGLTF_COMPONENT_TYPE_BYTE:
+                done = convertSimd<TINYGLTF_COMPONENT_TYPE_BYTE>(v, dst, dstStride, dc, &lo, &hi); break;
+            case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+                done = convertSimd<TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT>(v, dst, dstStride, dc, &lo, &hi); break;
+            case TINYGLTF_COMPONENT_TYPE_SHORT:
+                done = convertSimd<TINYGLTF_COMPONENT_TYPE_SHORT>(v, dst, dstStride, dc, &lo, &hi); break;
+            case TINYGLTF_COMPONENT_TYPE_INT:
+                done = convertSimd<TINYGLTF_COMPONENT_TYPE_INT>(v, dst, dstStride, dc, &lo, &hi); break;
+            default: break;
+        }
+        alignas(16) float l[4], h[4];
+        _mm_store_ps(l, lo);
+        _mm_store_ps(h, hi);
+        b.min = {l[0], l[1], l[2]};
+        b.max = {h[0], h[1], h[2]};
+    }
+#endif
+
+    for (size_t i = done; i < v.count; ++i)
+        convertElement(v, v.data ? v.data + i * v.stride : nullptr, dst + i * dstStride, dc);
+
+    // Sparse values replace base elements after the bulk pass
+    const size_t elem = (size_t)componentSize(v.componentType) * v.components;
+    for (size_t k = 0; k < v.sparseIndices.size(); ++k)
+        convertElement(v, v.sparseValues + k * elem, dst + v.sparseIndices[k] * dstStride, dc);
+
+    if (!bounds) return;
+    // Elements the SIMD pass didn't see (or saw before a sparse override)
+    size_t from = v.sparseIndices.empty() ? done : 0;
+    if (from == 0) b = AABB();
+    const int bc = std::min(dc, 3);
+    for (size_t i = from; i < v.count; ++i) {
+        const float* d = dst + i * dstStride;
+        for (int c = 0; c < bc; ++c) {
+            b.min[c] = std::min(b.min[c], d[c]);
+            b.max[c] = std::max(b.max[c], d[c]);
+        }
+    }
+    for (int c = 0; c < 3; ++c) {
+        bounds->min[c] = std::min(bounds->min[c], b.min[c]);
+        bounds->max[c] = std::max(bounds->max[c], b.max[c]);
+    }
+}
+
+void readAccessorFloats(const AccessorView& v, float* dst, size_t dstStride,
+                        int dc, AABB* bounds) {
+    readFloats(v, dst, dstStride, dc, bounds, true);
+}
+
+void fillFloats(float* dst, size_t count, size_t dstStride, int dc, const float* value) {
+    for (size_t i = 0; i < count; ++i)
+        std::memcpy(dst + i * dstStride, value, dc * sizeof(float));
+}
+
+static void readIndices(const AccessorView& v, uint32_t* dst, bool simd) {
+    if (!v.valid()) return;
+    const int csize = componentSize(v.componentType);
+    size_t i = 0;
+    if (v.data && v.stride == (size_t)csize && simd) {
+        if (csize == 4) {
+            std::memcpy(dst, v.data, v.count * 4);
+            i = v.count;
+        }
+#ifdef __SSE2__
+        const __m128i zero = _mm_setzero_si128();
+        if (csize == 2) {
+            for (; i + 8 <= v.count; i += 8) {
+                __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v.data + i * 2));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),     _mm_unpacklo_epi16(x, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 4), _mm_unpackhi_epi16(x, zero));
+            }
+        } else if (csize == 1) {
+            for (; i + 16 <= v.count; i += 16) {
+                __m128i x  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(v.data + i));
+                __m128i lo = _mm_unpacklo_epi8(x, zero), hi = _mm_unpackhi_epi8(x, zero);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),      _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 4),  _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8),  _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 12), _mm_unpackhi_epi16(hi, zero));
+            }
+        }
+#endif
+    }
+    for (; i < v.count; ++i) {
+        const unsigned char* p = v.data ? v.data + i * v.stride : nullptr;
+        uint32_t x = 0;
+        if (p) {
+            if (csize == 1)      x = p[0];
+            else if (csize == 2) { uint16_t u; std::memcpy(&u, p, 2); x = u; }
+            else                 std::memcpy(&x, p, 4);
+        }
+        dst[i] = x;
+    }
+    const size_t elem = csize;
+    for (size_t k = 0; k < v.sparseIndices.size(); ++k) {
+        const unsigned char* p = v.sparseValues + k * elem;
+        uint32_t x;
+        if (csize == 1)      x = p[0];
+        else if (csize == 2) { uint16_t u; std::memcpy(&u, p, 2); x = u; }
+        else                 std::memcpy(&x, p, 4);
+        dst[v.sparseIndices[k]] = x;
+    }
+}
+
+void readAccessorIndices(const AccessorView& v, uint32_t* dst) {
+    readIndices(v, dst, true);
+}
+
+// ---------------------------------------------------------------------------
+// Benchmark
+
+void benchmarkAccessorConversion() {
+    const size_t n = 1 << 20;   // vertices per stream
+    const int reps = 20;
+
+    struct Case {
+        const char* name;
+        int type, comps, stride;
+        bool normalized;
+        int dstComps;
+    };
+    const Case cases[] = {
+        {"float3 packed (POSITION)",      TINYGLTF_COMPONENT_TYPE_FLOAT,          3, 12, false, 3},
+        {"float3 stride 32 (interleaved)", TINYGLTF_COMPONENT_TYPE_FLOAT,         3, 32, false, 3},
+        {"float2 (TEXCOORD_0)",           TINYGLTF_COMPONENT_TYPE_FLOAT,          2,  8, false, 2},
+        {"u16 norm2 (TEXCOORD_0)",        TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT, 2,  4, true,  2},
+        {"i8 norm3 (NORMAL)",             TINYGLTF_COMPONENT_TYPE_BYTE,           3,  4, true,  3},
+        {"u8 x4 (JOINTS_0)",              TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE,  4,  4, false, 4},
+        {"u16 norm4 (WEIGHTS_0)",         TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT, 4,  8, true,  4},
+    };
+
+    std::vector<float> dst(n * 16);
+    for (const Case& c : cases) {
+        std::vector<unsigned char> src(n * c.stride + 16);
+        for (size_t i = 0; i < src.size(); ++i) src[i] = (unsigned char)(i * 7 + 3);
+        // keep float inputs finite
+        if (c.type == TINYGLTF_COMPONENT_TYPE_FLOAT)
+            for (size_t i = 0; i + 4 <= src.size(); i += 4) {
+                float f = (float)(i % 1000) * 0.01f;
+                std::memcpy(&src[i], &f, 4);
+            }
+
+        AccessorView v;
+        v.data = src.data();
+        v.end  = src.data() + src.size();
+        v.count = n;
+        v.stride = c.stride;
+        v.componentType = c.type;
+        v.components = c.comps;
+        v.normalized = c.normalized;
+
+        double mbps[2];
+        for (int simd = 1; simd >= 0; --simd) {
+            AABB box;
+            readFloats(v, dst.data(), 16, c.dstComps, &box, simd != 0);  // warm up
+            auto t0 = std::chrono::steady_clock::now();
+            for (int r = 0; r < reps; ++r)
+                readFloats(v, dst.data(), 16, c.dstComps, &box, simd != 0);
+            double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+            size_t bytes = (size_t)reps * n * componentSize(c.type) * c.comps;
+            mbps[simd] = bytes / 1e6 / std::max(s, 1e-9);
+        }
+        FT_LOG(Info, "  {}: {} MB/s (scalar {} MB/s)", c.name, mbps[1], mbps[0]);
+    }
+
+    std::vector<uint32_t> idx(n);
+    for (int csize : {1, 2}) {
+        std::vector<unsigned char> src(n * csize, 1);
+        AccessorView v;
+        v.data = src.data();
+        v.end  = src.data() + src.size();
+        v.count = n;
+        v.stride = csize;
+        v.componentType = csize == 1 ? TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE
+                                     : TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT;
+        v.components = 1;
+        double mbps[2];
+        for (int simd = 1; simd >= 0; --simd) {
+            auto t0 = std::chrono::steady_clock::now();
+            for (int r = 0; r < reps; ++r) readIndices(v, idx.data(), simd != 0);
+            double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+            mbps[simd] = (double)reps * n * csize / 1e6 / std::max(s, 1e-9);
+        }
+        FT_LOG(Info, "  u{} indices: {} MB/s (scalar {} MB/s)", csize * 8, mbps[1], mbps[0]);
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace tinygltf { class Model; }
+
+// Axis-aligned bounding box
+struct AABB {
+    glm::vec3 min{ 1e30f};
+    glm::vec3 max{-1e30f};
+
+    bool empty() const { return min.x > max.x; }
+};
+
+// Read-only view of one glTF accessor with the buffer view, byte stride,
+// component type, normalization and sparse substitution resolved.
+struct AccessorView {
+    const unsigned char* data = nullptr;   // element 0; null if all zeros
+    const unsigned char* end  = nullptr;   // end of the backing buffer
+    size_t count  = 0;
+    size_t stride = 0;                     // bytes between elements
+    int componentType = 0;                 // TINYGLTF_COMPONENT_TYPE_*
+    int components    = 0;                 // 1 (SCALAR) .. 4 (VEC4), 16 (MAT4)
+    bool normalized   = false;
+
+    // Sparse override: element sparseIndices[k] takes the value at
+    // sparseValues + k * elementSize
+    std::vector<uint32_t> sparseIndices;
+    const unsigned char*  sparseValues = nullptr;
+
+    bool valid() const { return count > 0 && components > 0; }
+};
+
+// Builds a view of model.accessors[accessor]. Returns false (and leaves an
+// invalid view) if the index or any referenced buffer range is bad.
+bool makeAccessorView(const tinygltf::Model& model, int accessor, AccessorView& out);
+
+// Converts the first `dstComponents` components of every element to float
+// (applying glTF normalization) and writes element i to dst + i * dstStride.
+// Missing source components are written as 0. If `bounds` is given it is
+// grown by the first three components of every element.
+void readAccessorFloats(const AccessorView& view, float* dst, size_t dstStride,
+                        int dstComponents, AABB* bounds = nullptr);
+
+// Writes `value` into the first components of `count` elements
+void fillFloats(float* dst, size_t count, size_t dstStride,
+                int dstComponents, const float* value);
+
+// Widens u8/u16/u32 indices to u32
+void readAccessorIndices(const AccessorView& view, uint32_t* dst);
+
+// Converts synthetic vertex streams of every supported layout and logs
+// throughput in MB/s, with and without the SIMD kernels.
+void benchmarkAccessorConversion();
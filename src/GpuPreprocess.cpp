@@ -0,0 +1,263 @@
+#include "GpuPreprocess.hpp"
+#include "EmbeddedResources.hpp"
+#include "Log.hpp"
+#include "Shader.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+GpuPreprocessor::GpuPreprocessor() {
+    program = loadShaderProgramFromSource(preprocessVertexShaderSrc, preprocessFragmentShaderSrc);
+    if (!program) return;
+    glUseProgram(program);
+    glUniform1i(glGetUniformLocation(program, "uSource"), 0);
+    locOutSize   = glGetUniformLocation(program, "uOutSize");
+    locBorder    = glGetUniformLocation(program, "uBorder");
+    locSrcOrigin = glGetUniformLocation(program, "uSrcOrigin");
+    locSrcExtent = glGetUniformLocation(program, "uSrcExtent");
+    locTapStep   = glGetUniformLocation(program, "uTapStep");
+    locTaps      = glGetUniformLocation(program, "uTaps");
+    locGray      = glGetUniformLocation(program, "uGray");
+    glUseProgram(0);
+    // The core profile wants a bound VAO even for attribute-less draws
+    glGenVertexArrays(1, &vao);
+}
+
+GpuPreprocessor::~GpuPreprocessor() {
+    release();
+    if (vao) glDeleteVertexArrays(1, &vao);
+    if (program) glDeleteProgram(program);
+}
+
+static void initTexture(GLuint texture, GLint internalFormat, GLenum format, cv::Size size) {
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, size.width, size.height, 0,
+                 format, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+}
+
+static cv::Size padded(cv::Size size, int border) {
+    return cv::Size(size.width + 2 * border, size.height + 2 * border);
+}
+
+void GpuPreprocessor::allocate(cv::Size size) {
+    release();
+    frameSize = size;
+    glGenTextures(1, &frameTexture);
+    initTexture(frameTexture, GL_RGB8, GL_BGR, size);
+    glGenBuffers(2, unpack);
+    for (GLuint b : unpack) {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, b);
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)size.area() * 3, nullptr, GL_STREAM_DRAW);
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    auto setup = [](Target& t, cv::Size s, int border, int type) {
+        t.size   = s;
+        t.border = border;
+        cv::Size full = padded(s, border);
+        bool gray = type == CV_8UC1;
+        glGenTextures(1, &t.texture);
+        initTexture(t.texture, gray ? GL_R8 : GL_RGBA8, gray ? GL_RED : GL_RGBA, full);
+        glGenFramebuffers(1, &t.fbo);
+        glBindFramebuffer(GL_FRAMEBUFFER, t.fbo);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, t.texture, 0);
+        glGenBuffers(2, t.pack);
+        for (int i = 0; i < 2; ++i) {
+            t.image[i].create(full, type);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, t.pack[i]);
+            glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)(t.image[i].total() * t.image[i].elemSize()),
+                         nullptr, GL_STREAM_READ);
+        }
+    };
+    // Level sizes round up, as cv::pyrDown's do
+    cv::Size s = trackingGraySize(size);
+    for (Target& level : levels) {
+        setup(level, s, kTrackingPyramidBorder, CV_8UC1);
+        s = cv::Size((s.width + 1) / 2, (s.height + 1) / 2);
+    }
+    setup(color, trackingColorSize(size), 0, CV_8UC3);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    FT_LOG(Info, "GpuPreprocessor: {}x{} frames to {}x{} gray, {} pyramid levels",
+           size.width, size.height, levels[0].size.width, levels[0].size.height,
+           kTrackingPyramidLevels);
+}
+
+void GpuPreprocessor::release() {
+    for (GLsync& f : fences) {
+        if (f) glDeleteSync(f);
+        f = nullptr;
+    }
+    auto drop = [](Target& t) {
+        if (t.fbo) glDeleteFramebuffers(1, &t.fbo);
+        if (t.texture) glDeleteTextures(1, &t.texture);
+        if (t.pack[0]) glDeleteBuffers(2, t.pack);
+        t = Target();
+    };
+    for (Target& level : levels) drop(level);
+    drop(color);
+    if (frameTexture) glDeleteTextures(1, &frameTexture);
+    if (unpack[0]) glDeleteBuffers(2, unpack);
+    frameTexture = 0;
+    unpack[0] = unpack[1] = 0;
+    frameSize = cv::Size();
+    pending = false;
+}
+
+void GpuPreprocessor::upload(const cv::Mat& frame, int s) {
+    size_t rowBytes = (size_t)frame.cols * 3;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpack[s]);
+    auto* dst = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, rowBytes * frame.rows,
+                                                 GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (dst) {
+        if (frame.isContinuous()) {
+            std::memcpy(dst, frame.data, rowBytes * frame.rows);
+        } else {
+            for (int y = 0; y < frame.rows; ++y)
+                std::memcpy(dst + rowBytes * y, frame.ptr(y), rowBytes);
+        }
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        // Row 0 lands at t = 0, so images come back top row first
+        glBindTexture(GL_TEXTURE_2D, frameTexture);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, frame.cols, frame.rows,
+                        GL_BGR, GL_UNSIGNED_BYTE, nullptr);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    } else {
+        FT_LOG_EVERY_MS(Warn, 5000, "GpuPreprocessor: mapping the upload buffer failed");
+    }
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+void GpuPreprocessor::draw(const Target& dst, GLuint source, cv::Size sourceSize,
+                           int sourceBorder, bool gray) {
+    cv::Size full = padded(dst.size, dst.border);
+    cv::Size inner(sourceSize.width - 2 * sourceBorder, sourceSize.height - 2 * sourceBorder);
+    glBindFramebuffer(GL_FRAMEBUFFER, dst.fbo);
+    glViewport(0, 0, full.width, full.height);
+    glBindTexture(GL_TEXTURE_2D, source);
+
+    // A box filter over the source pixels each output pixel covers, from a
+    // grid of bilinear taps that average 2x2 of them each
+    float rx = (float)inner.width / dst.size.width, ry = (float)inner.height / dst.size.height;
+    int taps = std::max(1, (int)std::ceil(std::max(rx, ry) * 0.5f));
+    glUniform2f(locOutSize, (float)dst.size.width, (float)dst.size.height);
+    glUniform1f(locBorder, (float)dst.border);
+    glUniform2f(locSrcOrigin, (float)sourceBorder / sourceSize.width,
+                (float)sourceBorder / sourceSize.height);
+    glUniform2f(locSrcExtent, (float)inner.width / sourceSize.width,
+                (float)inner.height / sourceSize.height);
+    glUniform2f(locTapStep, rx / taps / sourceSize.width, ry / taps / sourceSize.height);
+    glUniform1i(locTaps, taps);
+    glUniform1i(locGray, gray ? 1 : 0);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+void GpuPreprocessor::render(bool withColor, int s) {
+    // Leave the renderer's state as it was
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    GLboolean blend = glIsEnabled(GL_BLEND), depth = glIsEnabled(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_DEPTH_TEST);
+    glUseProgram(program);
+    glBindVertexArray(vao);
+    glActiveTexture(GL_TEXTURE0);
+    glBindSampler(0, 0);
+
+    // Gray from the frame, each pyramid level from the one above
+    draw(levels[0], frameTexture, frameSize, 0, true);
+    for (int l = 1; l < kTrackingPyramidLevels; ++l)
+        draw(levels[l], levels[l - 1].texture, padded(levels[l - 1].size, levels[l - 1].border),
+             levels[l - 1].border, false);
+    if (withColor) draw(color, frameTexture, frameSize, 0, false);
+
+    // Into this slot's pack buffers; nothing waits on them until collect()
+    auto readBack = [s](const Target& t, GLenum format) {
+        cv::Size full = padded(t.size, t.border);
+        glBindFramebuffer(GL_FRAMEBUFFER, t.fbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, t.pack[s]);
+        glReadPixels(0, 0, full.width, full.height, format, GL_UNSIGNED_BYTE, nullptr);
+    };
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    for (const Target& level : levels) readBack(level, GL_RED);
+    if (withColor) readBack(color, GL_BGR);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    fences[s]   = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    hasColor[s] = withColor;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindVertexArray(0);
+    glUseProgram(0);
+    glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+    if (blend) glEnable(GL_BLEND);
+    if (depth) glEnable(GL_DEPTH_TEST);
+}
+
+bool GpuPreprocessor::collect(int s, TrackingFrame& out) {
+    GLsync f = fences[s];
+    if (!f) return false;
+    // Normally long signalled: the readback was queued a frame ago
+    while (glClientWaitSync(f, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED) {}
+    glDeleteSync(f);
+    fences[s] = nullptr;
+
+    auto fetch = [s](Target& t) {
+        cv::Mat& image = t.image[s];
+        size_t bytes = image.total() * image.elemSize();
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, t.pack[s]);
+        const void* src = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, GL_MAP_READ_BIT);
+        if (!src) return false;
+        std::memcpy(image.data, src, bytes);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        return true;
+    };
+    bool ok = true;
+    out.pyramid.resize(kTrackingPyramidLevels);
+    for (int l = 0; l < kTrackingPyramidLevels; ++l) {
+        Target& t = levels[l];
+        ok = fetch(t) && ok;
+        out.pyramid[l] = t.image[s](cv::Rect(t.border, t.border, t.size.width, t.size.height));
+    }
+    out.gray = out.pyramid[0];
+    if (hasColor[s] && fetch(color)) out.color = color.image[s];
+    else out.color.release();
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    if (!ok) FT_LOG_EVERY_MS(Warn, 5000, "GpuPreprocessor: mapping a readback buffer failed");
+    return ok;
+}
+
+bool GpuPreprocessor::process(const cv::Mat& frame, bool withColor, TrackingFrame& out) {
+    if (!program || frame.empty()) return false;
+    if (frame.type() != CV_8UC3) {
+        prepareTrackingFrame(frame, out, withColor);
+        return true;
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    if (frame.size() != frameSize) allocate(frame.size());
+
+    int s = slot;
+    upload(frame, s);
+    render(withColor, s);
+    bool ready = pending && collect(s ^ 1, out);
+    pending = true;
+    slot = s ^ 1;
+
+    cpuMs += std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - t0).count();
+    if (++cpuFrames == 300) {
+        FT_LOG(Info, "GpuPreprocessor: CPU {} ms/frame (avg of {} frames)",
+               cpuMs / cpuFrames, cpuFrames);
+        cpuMs = 0.0;
+        cpuFrames = 0;
+    }
+    return ready;
+}
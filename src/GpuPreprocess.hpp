@@ -0,0 +1,64 @@
+#pragma once
+#include <glad/glad.h>
+#include "HeadPose.hpp"
+
+// Prepares TrackingFrames on the GPU instead of the CPU: the camera frame is
+// streamed through pixel unpack buffers into a texture, fragment shaders
+// convert and downscale it and build the optical-flow pyramid, and only
+// those small images are read back, through pack buffers, a frame later.
+// The CPU's share is two memcpys of the frame's size and a few small ones.
+// Needs the current GL context of the thread that calls it.
+class GpuPreprocessor {
+public:
+    GpuPreprocessor();
+    ~GpuPreprocessor();
+    GpuPreprocessor(const GpuPreprocessor&) = delete;
+    GpuPreprocessor& operator=(const GpuPreprocessor&) = delete;
+
+    // False if the shaders failed to build
+    bool valid() const { return program != 0; }
+
+    // Queues `frame` and fills `out` with the frame queued by the previous
+    // call, so results lag one frame. False while nothing is ready yet: the
+    // first call, and the first after a change of size. `out` stays valid
+    // until the call after next, so the tracker may keep the previous
+    // frame's pyramid. Frames other than 8-bit BGR are prepared on the CPU.
+    bool process(const cv::Mat& frame, bool withColor, TrackingFrame& out);
+
+private:
+    // One output image: a texture to render to and, per slot, a pack buffer
+    // and the CPU copy it lands in
+    struct Target {
+        GLuint   texture = 0, fbo = 0;
+        GLuint   pack[2] = {};
+        cv::Mat  image[2];            // padded, kTrackingPyramidBorder for levels
+        cv::Size size;                // without the border
+        int      border = 0;
+    };
+
+    void allocate(cv::Size frameSize);
+    void release();
+    void upload(const cv::Mat& frame, int slot);
+    void render(bool withColor, int slot);
+    bool collect(int slot, TrackingFrame& out);
+    void draw(const Target& dst, GLuint source, cv::Size sourceSize, int sourceBorder,
+              bool gray);
+
+    GLuint program = 0, vao = 0;
+    GLint  locOutSize = -1, locBorder = -1, locSrcOrigin = -1, locSrcExtent = -1;
+    GLint  locTapStep = -1, locTaps = -1, locGray = -1;
+
+    cv::Size frameSize;
+    GLuint   frameTexture = 0;
+    GLuint   unpack[2] = {};
+    Target   levels[kTrackingPyramidLevels];
+    Target   color;
+    GLsync   fences[2] = {};
+    bool     hasColor[2] = {};
+    int      slot = 0;
+    bool     pending = false;         // the other slot holds a queued frame
+
+    // CPU time spent per frame, logged every 300 frames
+    double cpuMs = 0.0;
+    int    cpuFrames = 0;
+};
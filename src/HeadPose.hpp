@@ -1,11 +1,105 @@
 #pragma once
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 #include <opencv2/opencv.hpp>
 #include <glm/glm.hpp>
 
-// Call this once at startup to load/enable the Haar cascade.
-// If loading fails, estimateHead() will simply return identity.
-void initHeadPose(const std::string& cascadePath);
+// Face detectors estimateHead() can run. YuNet (OpenCV DNN) copes with turned
+// heads and glasses and stays fast at high resolution; the Haar cascade is
+// the fallback when the YuNet model is not built in.
+enum class FaceDetectorKind { YuNet, Haar };
+
+// YuNet when its model was embedded at configure time, Haar otherwise
+FaceDetectorKind defaultFaceDetector();
+
+// Call this once at startup to load/enable the Haar cascade and the face
+// detector. If loading fails, estimateHead() will simply return identity.
+void initHeadPose(const std::string& cascadePath,
+                  FaceDetectorKind detector = defaultFaceDetector());
+
+// Same, but parses cascade XML already in memory (e.g. the embedded one),
+// avoiding the round trip through a temp file.
+void initHeadPoseFromMemory(std::string_view cascadeXml,
+                            FaceDetectorKind detector = defaultFaceDetector());
+
+const char* faceDetectorName(FaceDetectorKind kind);
+bool parseFaceDetector(const std::string& name, FaceDetectorKind& out);
+
+// Switches estimateHead() to `kind`. Falls back to Haar if YuNet is
+// unavailable; returns the detector now in use. Call on the thread that runs
+// estimateHead(), after initHeadPose*().
+FaceDetectorKind selectFaceDetector(FaceDetectorKind kind);
+FaceDetectorKind activeFaceDetector();
+
+// Between detections the face is followed with pyramidal Lucas-Kanade
+// optical flow; a full detection runs when too many tracked points are lost
+// and every 30 frames regardless. Disable to detect on every frame.
+void setFaceTracking(bool enabled);
+
+// Frames in which the face region is unchanged but for sensor noise reuse
+// the last pose instead of being tracked; after motion, tracking runs on
+// every frame again. See MotionGate.
+void setMotionGate(bool enabled);
+
+// Running totals for the detect/track split and per-stage time
+struct HeadTrackStats {
+    uint64_t detectFrames  = 0;  // frames that ran the face detector
+    uint64_t trackFrames   = 0;  // frames followed by optical flow alone
+    uint64_t skippedFrames = 0;  // frames the motion gate let reuse the last pose
+    uint64_t prepareFrames = 0;  // frames prepared on the CPU
+    double   detectMs      = 0;
+    double   trackMs       = 0;
+    double   poseMs        = 0;  // pose fit, all frames with a face
+    double   prepareMs     = 0;  // camera frame to TrackingFrame, CPU path
+};
+HeadTrackStats headTrackStats();
+
+// Tracking never looks at the full camera frame, only at these reductions of
+// it. They come from prepareTrackingFrame() on the CPU or from
+// GpuPreprocessor, which does the same work in shaders.
+constexpr int kTrackingWidth         = 640;  // gray image, optical flow and Haar
+constexpr int kDetectorWidth         = 320;  // color image, YuNet
+constexpr int kTrackingPyramidLevels = 4;    // gray plus three halvings
+constexpr int kTrackingPyramidBorder = 24;   // px around each level, >= the LK window
+
+struct TrackingFrame {
+    cv::Mat gray;                  // 8-bit, trackingGraySize() of the camera frame
+    cv::Mat color;                 // BGR, trackingColorSize(); empty if not asked for
+    // Optical-flow pyramid of `gray` (level 0 is gray itself), each level a
+    // view into a buffer with a border at least as wide as the LK window.
+    // Stays valid until the call after next, so the tracker may keep the
+    // previous frame's. Empty: the tracker builds its own.
+    std::vector<cv::Mat> pyramid;
+    cv::Mat scratch;               // full-size gray, CPU path only
+    std::vector<cv::Mat> levels[2];  // pyramid storage, CPU path only
+    int     slot = 0;              // of `levels` behind `pyramid`
+};
+
+cv::Size trackingGraySize(cv::Size frame);
+cv::Size trackingColorSize(cv::Size frame);
+
+// Whether the active detector needs TrackingFrame::color
+bool faceDetectorNeedsColor();
+
+// Grayscale conversion, downscaling and the optical-flow pyramid on the CPU.
+// Buffers in `out` are reused from frame to frame and do not reallocate
+// while the camera's frame size stays the same.
+void prepareTrackingFrame(const cv::Mat& frame, TrackingFrame& out, bool withColor);
 
 // Given a camera frame, returns a head‐pose matrix or identity if disabled.
+// Prepares the frame on the CPU; the TrackingFrame overload skips that.
 glm::mat4 estimateHead(const cv::Mat& frame);
+glm::mat4 estimateHead(const TrackingFrame& frame);
+
+// Runs every available detector, alone, with optical-flow tracking and with
+// tracking behind the motion gate, over the first `maxFrames` frames (0 =
+// all) of a recorded video and logs ms/frame, how many frames had a face and
+// the detect/track/skip split.
+bool benchmarkFaceDetectors(const std::string& videoPath, int maxFrames = 0);
+
+// Times the per-frame pose solver, warm- and cold-started, against
+// cv::solvePnP on `solves` synthetic noisy face fits and logs ns per solve
+// and rotation error against the true pose.
+bool benchmarkPoseSolvers(int solves);
@@ -0,0 +1,153 @@
+#include "Ktx2.hpp"
+#include "ThreadPool.hpp"
+#include "Log.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <basisu_transcoder.h>
+
+static const unsigned char kIdentifier[12] = {
+    0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+// Fixed part of the file following the identifier
+struct Ktx2Header {
+    uint32_t vkFormat, typeSize, pixelWidth, pixelHeight, pixelDepth;
+    uint32_t layerCount, faceCount, levelCount, supercompressionScheme;
+    uint32_t dfdByteOffset, dfdByteLength, kvdByteOffset, kvdByteLength;
+    uint32_t sgdByteOffset[2], sgdByteLength[2];  // u64, only 4-byte aligned here
+};
+static_assert(sizeof(Ktx2Header) == 68, "KTX2 header layout");
+
+struct Ktx2Level {
+    uint64_t byteOffset, byteLength, uncompressedByteLength;
+};
+
+// The VkFormats we can hand to GL unchanged
+enum : uint32_t {
+    kVkUndefined     = 0,    // Basis Universal payload
+    kVkRGBA8Unorm    = 37,
+    kVkRGBA8Srgb     = 43,
+    kVkBC1RgbUnorm   = 131,
+    kVkBC1RgbSrgb    = 132,
+    kVkBC3Unorm      = 137,
+    kVkBC3Srgb       = 138,
+    kVkBC7Unorm      = 145,
+    kVkBC7Srgb       = 146,
+};
+
+bool isKtx2(const unsigned char* data, size_t size) {
+    return size >= sizeof(kIdentifier) && !std::memcmp(data, kIdentifier, sizeof(kIdentifier));
+}
+
+static bool readHeader(const unsigned char* data, size_t size, Ktx2Header& h,
+                       std::vector<Ktx2Level>& levels) {
+    if (!isKtx2(data, size) || size < sizeof(kIdentifier) + sizeof(h)) return false;
+    std::memcpy(&h, data + sizeof(kIdentifier), sizeof(h));
+    if (!h.pixelWidth || !h.pixelHeight || h.pixelDepth > 1 || h.layerCount > 1 ||
+        h.faceCount != 1 || h.levelCount > 32)
+        return false;
+
+    levels.resize(std::max(h.levelCount, 1u));
+    const size_t indexAt = sizeof(kIdentifier) + sizeof(h);
+    if (size - indexAt < levels.size() * sizeof(Ktx2Level)) return false;
+    std::memcpy(levels.data(), data + indexAt, levels.size() * sizeof(Ktx2Level));
+    for (auto& l : levels)
+        if (l.byteOffset > size || size - l.byteOffset < l.byteLength) return false;
+    return true;
+}
+
+// Levels stored as-is in a format the context supports
+static bool copyLevels(const unsigned char* data, const Ktx2Header& h,
+                       const std::vector<Ktx2Level>& levels, const TextureCaps& caps,
+                       EncodedTexture& out) {
+    switch (h.vkFormat) {
+        case kVkRGBA8Unorm: case kVkRGBA8Srgb:
+            out.format = TextureFormat::RGBA8; break;
+        case kVkBC1RgbUnorm: case kVkBC1RgbSrgb:
+            if (!caps.s3tc) return false;
+            out.format = TextureFormat::BC1; break;
+        case kVkBC3Unorm: case kVkBC3Srgb:
+            if (!caps.s3tc) return false;
+            out.format = TextureFormat::BC3; break;
+        case kVkBC7Unorm: case kVkBC7Srgb:
+            if (!caps.bptc) return false;
+            out.format = TextureFormat::BC7; break;
+        default:
+            return false;
+    }
+    const size_t bytesPerBlock = out.format == TextureFormat::BC1 ? 8 : 16;
+    out.levels.resize(levels.size());
+    for (size_t i = 0; i < levels.size(); ++i) {
+        TextureLevel& l = out.levels[i];
+        l.width  = (int)std::max(1u, h.pixelWidth  >> i);
+        l.height = (int)std::max(1u, h.pixelHeight >> i);
+        size_t expected = out.format == TextureFormat::RGBA8
+            ? (size_t)l.width * l.height * 4
+            : (size_t)((l.width + 3) / 4) * ((l.height + 3) / 4) * bytesPerBlock;
+        if (levels[i].byteLength != expected) return false;
+        l.data.assign(data + levels[i].byteOffset, data + levels[i].byteOffset + expected);
+    }
+    return true;
+}
+
+static bool transcodeLevels(const unsigned char* data, size_t size, const TextureCaps& caps,
+                            EncodedTexture& out) {
+    static std::once_flag init;
+    std::call_once(init, [] { basist::basisu_transcoder_init(); });
+
+    basist::ktx2_transcoder ktx;
+    if (!ktx.init(data, (uint32_t)size) || !ktx.start_transcoding() || !ktx.get_levels())
+        return false;
+
+    out.format = chooseTextureFormat(caps, ktx.get_has_alpha());
+    basist::transcoder_texture_format target = basist::transcoder_texture_format::cTFRGBA32;
+    switch (out.format) {
+        case TextureFormat::BC1:   target = basist::transcoder_texture_format::cTFBC1_RGB;  break;
+        case TextureFormat::BC3:   target = basist::transcoder_texture_format::cTFBC3_RGBA; break;
+        case TextureFormat::BC7:   target = basist::transcoder_texture_format::cTFBC7_RGBA; break;
+        case TextureFormat::RGBA8: break;
+    }
+    const uint32_t unit = basist::basis_get_bytes_per_block_or_pixel(target);
+
+    out.levels.resize(ktx.get_levels());
+    for (size_t i = 0; i < out.levels.size(); ++i) {
+        TextureLevel& l = out.levels[i];
+        l.width  = (int)std::max(1u, ktx.get_width()  >> i);
+        l.height = (int)std::max(1u, ktx.get_height() >> i);
+        size_t units = out.format == TextureFormat::RGBA8
+            ? (size_t)l.width * l.height
+            : (size_t)((l.width + 3) / 4) * ((l.height + 3) / 4);
+        l.data.resize(units * unit);
+    }
+
+    // The transcoder is read-only after start_transcoding(); each level gets
+    // its own scratch state
+    std::vector<char> ok(out.levels.size(), 0);
+    ThreadPool::loaders().parallelFor(out.levels.size(), [&](size_t i) {
+        basist::ktx2_transcoder_state state;
+        TextureLevel& l = out.levels[i];
+        ok[i] = ktx.transcode_image_level((uint32_t)i, 0, 0, l.data.data(),
+                                          (uint32_t)(l.data.size() / unit), target,
+                                          0, 0, 0, -1, -1, &state);
+    });
+    for (char o : ok) if (!o) return false;
+    return true;
+}
+
+bool decodeKtx2(const unsigned char* data, size_t size, const TextureCaps& caps,
+                EncodedTexture& out) {
+    Ktx2Header h;
+    std::vector<Ktx2Level> levels;
+    if (!readHeader(data, size, h, levels)) {
+        FT_LOG(Warn, "KTX2: unsupported or corrupt file");
+        return false;
+    }
+    if (h.vkFormat == kVkUndefined) return transcodeLevels(data, size, caps, out);
+    if (h.supercompressionScheme != 0 || !copyLevels(data, h, levels, caps, out)) {
+        FT_LOG(Warn, "KTX2: VkFormat {} (supercompression {}) is not supported here",
+               h.vkFormat, h.supercompressionScheme);
+        return false;
+    }
+    return true;
+}
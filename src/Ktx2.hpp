@@ -0,0 +1,15 @@
+#pragma once
+#include <cstddef>
+#include "TextureCompression.hpp"
+
+// KTX2 textures (KHR_texture_basisu).
+//
+// Files holding BCn or RGBA8 levels without supercompression are uploaded
+// as they are. Basis Universal payloads (ETC1S/BasisLZ and UASTC) are
+// transcoded to BC7, BC3/BC1 or RGBA8, whichever the context supports best,
+// one mip level per task on ThreadPool::loaders().
+
+bool isKtx2(const unsigned char* data, size_t size);
+
+bool decodeKtx2(const unsigned char* data, size_t size, const TextureCaps& caps,
+                EncodedTexture& out);
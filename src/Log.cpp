@@ -0,0 +1,245 @@
+#include "Log.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+std::atomic<int> gLogLevel{(int)LogLevel::Info};
+
+// Bounded multi-producer queue (Vyukov); the writer thread is the only consumer.
+static constexpr size_t kQueueSize = 1024;  // power of two
+
+namespace {
+struct Cell {
+    std::atomic<size_t> seq;
+    LogRecord           rec;
+};
+}
+
+static std::unique_ptr<Cell[]> cells;
+static std::atomic<size_t>     enqueuePos{0};
+static size_t                  dequeuePos = 0;
+static std::atomic<uint64_t>   dropped{0};
+
+static std::thread       writer;
+static std::atomic<bool> writerRunning{false};
+static std::atomic<bool> stopRequested{false};
+
+// Timestamps are printed relative to process start.
+static const int64_t startNs = logdetail::nowNs();
+
+static const char* levelTag(LogLevel l) {
+    switch (l) {
+        case LogLevel::Trace: return "T";
+        case LogLevel::Debug: return "D";
+        case LogLevel::Info:  return "I";
+        case LogLevel::Warn:  return "W";
+        case LogLevel::Error: return "E";
+        default:              return "?";
+    }
+}
+
+static void freeStrings(LogRecord& r) {
+    for (int i = 0; i < r.argCount; ++i) {
+        if (r.args[i].type == LogArg::Str && r.args[i].s.owned)
+            std::free(const_cast<char*>(r.args[i].s.ptr));
+    }
+}
+
+static size_t appendArg(char* out, size_t cap, const LogRecord& r, const LogArg& a) {
+    int n = 0;
+    switch (a.type) {
+        case LogArg::Int:    n = std::snprintf(out, cap, "%lld", (long long)a.i); break;
+        case LogArg::UInt:   n = std::snprintf(out, cap, "%llu", (unsigned long long)a.u); break;
+        case LogArg::Double: n = std::snprintf(out, cap, "%g", a.d); break;
+        case LogArg::Bool:   n = std::snprintf(out, cap, "%s", a.u ? "true" : "false"); break;
+        case LogArg::Str: {
+            const char* p = a.s.owned ? a.s.ptr : r.text + (size_t)a.s.ptr;
+            n = std::snprintf(out, cap, "%.*s", (int)a.s.len, p);
+            break;
+        }
+    }
+    if (n < 0) return 0;
+    return std::min((size_t)n, cap ? cap - 1 : 0);
+}
+
+// Expands "{}" placeholders in order; extra arguments are appended.
+static void formatRecord(const LogRecord& r, std::string& line) {
+    char buf[4096];
+    size_t len = (size_t)std::snprintf(buf, sizeof(buf), "[%s %9.3f] ",
+        levelTag(r.level), (r.timeNs - startNs) / 1e9);
+
+    int argIdx = 0;
+    for (const char* f = r.fmt; *f && len < sizeof(buf) - 1; ++f) {
+        if (f[0] == '{' && f[1] == '}') {
+            if (argIdx < r.argCount)
+                len += appendArg(buf + len, sizeof(buf) - len, r, r.args[argIdx++]);
+            ++f;
+        } else {
+            buf[len++] = *f;
+        }
+    }
+    for (; argIdx < r.argCount && len < sizeof(buf) - 2; ++argIdx) {
+        buf[len++] = ' ';
+        len += appendArg(buf + len, sizeof(buf) - len, r, r.args[argIdx]);
+    }
+    if (r.suppressed && len < sizeof(buf) - 1) {
+        len += (size_t)std::snprintf(buf + len, sizeof(buf) - len,
+                                     " (%u similar suppressed)", r.suppressed);
+        len = std::min(len, sizeof(buf) - 1);
+    }
+    line.append(buf, len);
+    line.push_back('\n');
+}
+
+static bool tryDequeue(LogRecord& out) {
+    Cell& c = cells[dequeuePos & (kQueueSize - 1)];
+    if (c.seq.load(std::memory_order_acquire) != dequeuePos + 1) return false;
+    out = c.rec;
+    c.seq.store(dequeuePos + kQueueSize, std::memory_order_release);
+    ++dequeuePos;
+    return true;
+}
+
+static void drain(std::string& batch) {
+    LogRecord r;
+    while (tryDequeue(r)) {
+        formatRecord(r, batch);
+        freeStrings(r);
+    }
+    if (uint64_t n = dropped.exchange(0, std::memory_order_relaxed)) {
+        batch += "[W] log queue full, dropped " + std::to_string(n) + " records\n";
+    }
+    if (!batch.empty()) {
+        std::fwrite(batch.data(), 1, batch.size(), stderr);
+        std::fflush(stderr);
+        batch.clear();
+    }
+}
+
+static void writerLoop() {
+    std::string batch;
+    batch.reserve(16 * 1024);
+    while (!stopRequested.load(std::memory_order_acquire)) {
+        drain(batch);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    drain(batch);
+}
+
+static LogLevel levelFromEnv() {
+    const char* env = std::getenv("FREETUBER_LOG");
+    if (!env) return LogLevel::Info;
+    static const char* names[] = {"trace", "debug", "info", "warn", "error", "off"};
+    for (int i = 0; i <= (int)LogLevel::Off; ++i)
+        if (!std::strcmp(env, names[i])) return (LogLevel)i;
+    return LogLevel::Info;
+}
+
+void logInit() {
+    logInit(levelFromEnv());
+}
+
+void logInit(LogLevel level) {
+    logSetLevel(level);
+    if (writerRunning.load()) return;
+
+    cells.reset(new Cell[kQueueSize]);
+    for (size_t i = 0; i < kQueueSize; ++i)
+        cells[i].seq.store(i, std::memory_order_relaxed);
+    enqueuePos.store(0, std::memory_order_relaxed);
+    dequeuePos = 0;
+
+    stopRequested.store(false);
+    writer = std::thread(writerLoop);
+    writerRunning.store(true, std::memory_order_release);
+
+    static bool registered = false;
+    if (!registered) { std::atexit(logShutdown); registered = true; }
+}
+
+void logShutdown() {
+    if (!writerRunning.exchange(false)) return;
+    stopRequested.store(true, std::memory_order_release);
+    writer.join();
+}
+
+void logSetLevel(LogLevel level) {
+    gLogLevel.store((int)level, std::memory_order_relaxed);
+}
+
+void logSubmit(LogRecord& rec) {
+    if (!writerRunning.load(std::memory_order_acquire)) {
+        // No writer thread (before logInit / after shutdown): write inline.
+        std::string line;
+        formatRecord(rec, line);
+        freeStrings(rec);
+        std::fwrite(line.data(), 1, line.size(), stderr);
+        return;
+    }
+
+    size_t pos = enqueuePos.load(std::memory_order_relaxed);
+    Cell* c;
+    for (;;) {
+        c = &cells[pos & (kQueueSize - 1)];
+        size_t seq = c->seq.load(std::memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+        if (dif == 0) {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (dif < 0) {
+            // Queue full: never block the caller.
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            freeStrings(rec);
+            return;
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    c->rec = rec;
+    c->seq.store(pos + 1, std::memory_order_release);
+}
+
+bool LogRateLimit::allow() {
+    int64_t now  = logdetail::nowNs();
+    int64_t next = nextNs.load(std::memory_order_relaxed);
+    if (now >= next &&
+        nextNs.compare_exchange_strong(next, now + intervalNs, std::memory_order_relaxed)) {
+        return true;
+    }
+    suppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+namespace logdetail {
+
+void pushString(LogRecord& r, std::string_view s) {
+    LogArg& a = r.args[r.argCount++];
+    a.type  = LogArg::Str;
+    a.s.len = (uint32_t)s.size();
+    if (r.textUsed + s.size() <= (size_t)LogRecord::kInlineText) {
+        // Inline strings store their offset into r.text, so the record stays
+        // valid when it is copied into the queue.
+        std::memcpy(r.text + r.textUsed, s.data(), s.size());
+        a.s.ptr   = reinterpret_cast<const char*>((uintptr_t)r.textUsed);
+        a.s.owned = false;
+        r.textUsed += (uint16_t)s.size();
+    } else {
+        // Rare (e.g. shader info logs): spill to the heap, freed by the writer.
+        char* p = static_cast<char*>(std::malloc(s.size()));
+        if (p) std::memcpy(p, s.data(), s.size());
+        else   a.s.len = 0;
+        a.s.ptr   = p;
+        a.s.owned = true;
+    }
+}
+
+int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace logdetail
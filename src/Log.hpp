@@ -0,0 +1,142 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Asynchronous logging.
+//
+//   FT_LOG(Info, "loaded {} meshes from {}", count, path);
+//   FT_LOG_EVERY_MS(Debug, 1000, "pose {} {} {}", pitch, yaw, roll);
+//
+// The call site only copies its arguments into a fixed-size record and pushes
+// it onto a lock-free queue; formatting and the write to stderr happen on a
+// background thread. Statements below FT_LOG_COMPILE_LEVEL compile to nothing,
+// and statements below the runtime level cost one relaxed load. Arguments are
+// never evaluated for disabled statements. The format string must be a literal.
+
+enum class LogLevel : int { Trace = 0, Debug, Info, Warn, Error, Off };
+
+#ifndef FT_LOG_COMPILE_LEVEL
+#define FT_LOG_COMPILE_LEVEL 1  // LogLevel::Debug
+#endif
+
+// Starts the writer thread. The level defaults to $FREETUBER_LOG
+// (trace|debug|info|warn|error|off), or Info if unset.
+void logInit();
+void logInit(LogLevel level);
+// Drains the queue and stops the writer thread (also registered with atexit).
+void logShutdown();
+void logSetLevel(LogLevel level);
+
+extern std::atomic<int> gLogLevel;
+
+inline bool logEnabled(LogLevel level) {
+    return (int)level >= gLogLevel.load(std::memory_order_relaxed);
+}
+
+// Lets at most one message through per interval; counts the rest so the next
+// message that gets through can report how many were suppressed.
+class LogRateLimit {
+public:
+    explicit LogRateLimit(uint32_t intervalMs) : intervalNs((int64_t)intervalMs * 1000000) {}
+    bool     allow();
+    uint32_t takeSuppressed() { return suppressed.exchange(0, std::memory_order_relaxed); }
+
+private:
+    const int64_t         intervalNs;
+    std::atomic<int64_t>  nextNs{0};
+    std::atomic<uint32_t> suppressed{0};
+};
+
+// Fixed-size record handed to the writer thread.
+struct LogArg {
+    enum Type : uint8_t { Int, UInt, Double, Bool, Str };
+    Type type;
+    union {
+        int64_t  i;
+        uint64_t u;
+        double   d;
+        struct { const char* ptr; uint32_t len; bool owned; } s;
+    };
+};
+
+struct LogRecord {
+    static constexpr int kMaxArgs    = 8;
+    static constexpr int kInlineText = 384;
+
+    int64_t     timeNs;
+    const char* fmt;
+    LogLevel    level;
+    uint8_t     argCount;
+    uint16_t    textUsed;
+    uint32_t    suppressed;
+    LogArg      args[kMaxArgs];
+    char        text[kInlineText];  // inline storage for string arguments
+};
+
+void logSubmit(LogRecord& rec);
+
+namespace logdetail {
+
+void pushString(LogRecord& r, std::string_view s);
+
+template <class T>
+inline void pushArg(LogRecord& r, const T& v) {
+    using U = std::decay_t<T>;
+    if constexpr (std::is_same_v<U, bool>) {
+        LogArg& a = r.args[r.argCount++];
+        a.type = LogArg::Bool; a.u = v ? 1 : 0;
+    } else if constexpr (std::is_enum_v<U>) {
+        LogArg& a = r.args[r.argCount++];
+        a.type = LogArg::Int; a.i = (int64_t)v;
+    } else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) {
+        LogArg& a = r.args[r.argCount++];
+        a.type = LogArg::Int; a.i = v;
+    } else if constexpr (std::is_integral_v<U>) {
+        LogArg& a = r.args[r.argCount++];
+        a.type = LogArg::UInt; a.u = v;
+    } else if constexpr (std::is_floating_point_v<U>) {
+        LogArg& a = r.args[r.argCount++];
+        a.type = LogArg::Double; a.d = v;
+    } else if constexpr (std::is_convertible_v<const U&, std::string_view>) {
+        pushString(r, std::string_view(v));
+    } else {
+        static_assert(std::is_convertible_v<const U&, std::string_view>,
+                      "unsupported log argument type");
+    }
+}
+
+int64_t nowNs();
+
+} // namespace logdetail
+
+template <class... Args>
+void logWrite(LogLevel level, uint32_t suppressed, const char* fmt, const Args&... args) {
+    static_assert(sizeof...(Args) <= LogRecord::kMaxArgs, "too many log arguments");
+    LogRecord r;
+    r.timeNs     = logdetail::nowNs();
+    r.fmt        = fmt;
+    r.level      = level;
+    r.argCount   = 0;
+    r.textUsed   = 0;
+    r.suppressed = suppressed;
+    (logdetail::pushArg(r, args), ...);
+    logSubmit(r);
+}
+
+#define FT_LOG_ON(level) \
+    ((int)LogLevel::level >= FT_LOG_COMPILE_LEVEL && logEnabled(LogLevel::level))
+
+#define FT_LOG(level, ...) \
+    do { if (FT_LOG_ON(level)) logWrite(LogLevel::level, 0, __VA_ARGS__); } while (0)
+
+#define FT_LOG_EVERY_MS(level, ms, ...)                                         \
+    do {                                                                        \
+        if (FT_LOG_ON(level)) {                                                 \
+            static LogRateLimit ftLogSite_(ms);                                 \
+            if (ftLogSite_.allow())                                             \
+                logWrite(LogLevel::level, ftLogSite_.takeSuppressed(), __VA_ARGS__); \
+        }                                                                       \
+    } while (0)
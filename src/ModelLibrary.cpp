@@ -0,0 +1,34 @@
+#include "ModelLibrary.hpp"
+#include <filesystem>
+
+std::string ModelLibrary::key(const std::string& path) {
+    std::error_code ec;
+    auto p = std::filesystem::weakly_canonical(path, ec);
+    return ec ? path : p.string();
+}
+
+ModelLibrary& ModelLibrary::shared() {
+    static ModelLibrary library;
+    return library;
+}
+
+std::shared_ptr<const Model> ModelLibrary::find(const std::string& path) {
+    auto it = byPath.find(key(path));
+    if (it == byPath.end()) return nullptr;
+    auto model = it->second.lock();
+    if (!model) byPath.erase(it);
+    return model;
+}
+
+std::shared_ptr<const Model> ModelLibrary::publish(const std::string& path, Model model) {
+    auto shared = shareModel(std::move(model));
+    byPath[key(path)] = shared;
+    return shared;
+}
+
+std::shared_ptr<const Model> shareModel(Model model) {
+    return std::shared_ptr<const Model>(new Model(std::move(model)), [](const Model* m) {
+        releaseModel(*const_cast<Model*>(m));
+        delete m;
+    });
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "VRMLoader.hpp"
+
+// Uploaded models by file, so avatars showing the same VRM share one copy of
+// its buffers and textures. Entries are weak: a model is released (on the
+// GL thread) when the last avatar drops it. GL thread only.
+class ModelLibrary {
+public:
+    static ModelLibrary& shared();
+
+    // The loaded model for `path`, or null
+    std::shared_ptr<const Model> find(const std::string& path);
+
+    // Makes `model`, freshly uploaded from `path`, the version find() returns
+    // from now on. Avatars still holding an older version keep it.
+    std::shared_ptr<const Model> publish(const std::string& path, Model model);
+
+    // What find() and publish() key `path` by: different spellings of one
+    // file give the same key
+    static std::string key(const std::string& path);
+
+private:
+    std::unordered_map<std::string, std::weak_ptr<const Model>> byPath;
+};
+
+// Takes over an uploaded model; the last owner releases its GL objects
+std::shared_ptr<const Model> shareModel(Model model);
@@ -0,0 +1,117 @@
+#include "ModelSwap.hpp"
+#include "ModelLibrary.hpp"
+#include "Log.hpp"
+#include <chrono>
+
+// How often the worker looks at the watched file's modification time
+static constexpr auto kWatchInterval = std::chrono::seconds(1);
+
+ModelSwapper::ModelSwapper(std::string initialPath, size_t uploadBytesPerFrame)
+  : uploadBudget(uploadBytesPerFrame), shownPath(std::move(initialPath)) {
+    worker = std::thread(&ModelSwapper::workerLoop, this);
+}
+
+ModelSwapper::~ModelSwapper() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stop = true;
+    }
+    cv.notify_all();
+    worker.join();
+    // A model that was still mid-upload is dropped with the GL context.
+}
+
+void ModelSwapper::request(const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        requested = path;
+    }
+    cv.notify_all();
+}
+
+void ModelSwapper::watch(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mtx);
+    watched = path;
+}
+
+void ModelSwapper::workerLoop() {
+    namespace fs = std::filesystem;
+    std::string        stampPath;
+    fs::file_time_type stamp{}, pendingStamp{};
+
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        cv.wait_for(lock, kWatchInterval, [&] { return stop || requested.has_value(); });
+        if (stop) return;
+
+        std::string path;
+        if (requested) {
+            path = *requested;
+            requested.reset();
+        } else if (!watched.empty()) {
+            std::string w = watched;
+            lock.unlock();
+            std::error_code ec;
+            auto t = fs::last_write_time(w, ec);
+            if (!ec) {
+                if (w != stampPath) {
+                    // New watch target: remember its current state
+                    stampPath = w;
+                    stamp = pendingStamp = t;
+                } else if (t != stamp) {
+                    // Reload only once the file stopped changing for a tick,
+                    // so we don't parse a half-written export.
+                    if (t == pendingStamp) {
+                        stamp = t;
+                        path  = w;
+                        FT_LOG(Info, "ModelSwap: {} changed on disk, reloading", w);
+                    }
+                    pendingStamp = t;
+                }
+            }
+            lock.lock();
+        }
+        if (path.empty()) continue;
+
+        lock.unlock();
+        auto t0   = std::chrono::steady_clock::now();
+        auto data = std::make_unique<VRMData>();
+        bool ok   = parseVRM(path, *data);
+        double ms = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - t0).count();
+        lock.lock();
+
+        if (!ok) {
+            FT_LOG(Error, "ModelSwap: failed to load {}, keeping current model", path);
+            continue;
+        }
+        if (requested) continue;  // superseded while we were parsing
+
+        FT_LOG(Info, "ModelSwap: parsed {} in {} ms", path, ms);
+        parsed     = std::move(data);
+        parsedPath = path;
+        parsedReady.store(true, std::memory_order_release);
+    }
+}
+
+bool ModelSwapper::update(std::shared_ptr<const Model>& current) {
+    if (!uploader && parsedReady.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (parsed) {
+            uploader      = std::make_unique<VRMUploader>(std::move(*parsed));
+            uploadingPath = parsedPath;
+            parsed.reset();
+        }
+        parsedReady.store(false, std::memory_order_relaxed);
+    }
+    if (!uploader) return false;
+
+    // Amortize the upload; the old model keeps rendering until it's done
+    if (!uploader->step(uploadBudget)) return false;
+
+    current = ModelLibrary::shared().publish(uploadingPath, std::move(uploader->result()));
+    uploader.reset();
+    shownPath = uploadingPath;
+    FT_LOG(Info, "ModelSwap: now showing {} ({} meshes)", shownPath, current->meshes.size());
+    return true;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include "VRMLoader.hpp"
+
+// Switches avatars at runtime without restarting or stalling the render loop.
+// A worker thread parses and decodes the new model; update() then uploads it
+// a slice per frame, publishes it to the ModelLibrary and hands it over at a
+// frame boundary. The old model is released once no avatar shows it.
+class ModelSwapper {
+public:
+    // `initialPath` is the model already shown (what R reloads)
+    explicit ModelSwapper(std::string initialPath,
+                          size_t uploadBytesPerFrame = 8u << 20);
+    ~ModelSwapper();
+    ModelSwapper(const ModelSwapper&) = delete;
+    ModelSwapper& operator=(const ModelSwapper&) = delete;
+
+    // Load `path` in the background (callable from any thread, e.g. a GLFW
+    // drop callback). A newer request supersedes one still being parsed.
+    void request(const std::string& path);
+
+    // Reload `path` whenever the file on disk changes.
+    void watch(const std::string& path);
+
+    // GL thread, once per frame between frames. Returns true when `current`
+    // was replaced by a newly loaded model.
+    bool update(std::shared_ptr<const Model>& current);
+
+    // Path of the model currently being loaded or most recently swapped in
+    const std::string& currentPath() const { return shownPath; }
+
+private:
+    void workerLoop();
+
+    const size_t uploadBudget;
+
+    std::mutex              mtx;
+    std::condition_variable cv;
+    std::optional<std::string> requested;   // next path to parse
+    std::string             watched;
+    std::unique_ptr<VRMData> parsed;        // handed from worker to GL thread
+    std::string             parsedPath;
+    bool                    stop = false;
+    std::atomic<bool>       parsedReady{false};
+
+    // GL thread only
+    std::unique_ptr<VRMUploader> uploader;
+    std::string                  uploadingPath, shownPath;
+
+    std::thread worker;
+};
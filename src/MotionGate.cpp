@@ -0,0 +1,75 @@
+#include "MotionGate.hpp"
+#include <algorithm>
+#include <cstdlib>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+uint64_t sumAbsDiff(const cv::Mat& a, const cv::Mat& b) {
+    uint64_t sum = 0;
+    for (int y = 0; y < a.rows; ++y) {
+        const uint8_t* p = a.ptr<uint8_t>(y);
+        const uint8_t* q = b.ptr<uint8_t>(y);
+        int x = 0;
+#ifdef __SSE2__
+        // psadbw: 16 absolute differences summed into two 64-bit lanes
+        __m128i acc = _mm_setzero_si128();
+        for (; x + 16 <= a.cols; x += 16) {
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + x));
+            __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q + x));
+            acc = _mm_add_epi64(acc, _mm_sad_epu8(va, vb));
+        }
+        alignas(16) uint64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc);
+        sum += lanes[0] + lanes[1];
+#endif
+        for (; x < a.cols; ++x) sum += (uint64_t)std::abs(p[x] - q[x]);
+    }
+    return sum;
+}
+
+// The region, area-averaged down to kThumbSize square; false if it has left
+// the frame
+bool MotionGate::thumbnail(const cv::Mat& gray, cv::Mat& out) {
+    cv::Rect r = region & cv::Rect(0, 0, gray.cols, gray.rows);
+    if (r.width < kThumbSize / 2 || r.height < kThumbSize / 2) return false;
+    cv::resize(gray(r), out, cv::Size(kThumbSize, kThumbSize), 0, 0, cv::INTER_AREA);
+    return true;
+}
+
+bool MotionGate::skip(const cv::Mat& gray) {
+    if (!enabled || !hasReference || !thumbnail(gray, current)) return false;
+    lastDifference = (float)sumAbsDiff(current, reference) / (kThumbSize * kThumbSize);
+
+    if (lastDifference >= threshold) {
+        hold = kHoldFrames;
+        maxSkips = 1;
+        return false;
+    }
+    if (hold > 0) {
+        --hold;
+        return false;
+    }
+    if (skipped < maxSkips) {
+        ++skipped;
+        return true;
+    }
+    // Still after a full interval: re-track now, then wait longer
+    maxSkips = std::min(maxSkips * 2 + 1, kMaxSkips);
+    return false;
+}
+
+void MotionGate::update(const cv::Mat& gray, const cv::Rect& face) {
+    // A margin around the box, so motion at its edges counts
+    int mx = face.width / 8, my = face.height / 8;
+    region = cv::Rect(face.x - mx, face.y - my, face.width + 2 * mx, face.height + 2 * my);
+    hasReference = thumbnail(gray, reference);
+    skipped = 0;
+}
+
+void MotionGate::reset() {
+    hasReference = false;
+    hold = 0;
+    skipped = 0;
+    maxSkips = 1;
+}
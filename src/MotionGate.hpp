@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <opencv2/opencv.hpp>
+
+// Sum of absolute differences of two 8-bit single-channel images of the
+// same size (SSE2 where available)
+uint64_t sumAbsDiff(const cv::Mat& a, const cv::Mat& b);
+
+// Decides which frames need tracking at all. The face box of the last
+// tracked frame is reduced to a small gray thumbnail; while later frames
+// show that region unchanged (mean absolute difference below a threshold,
+// i.e. sensor noise) they can reuse the last pose. A still face is still
+// re-tracked at a rate that backs off from every 2nd to every 8th frame;
+// any motion puts tracking back on every frame for a while.
+class MotionGate {
+public:
+    // True if `gray` may reuse the last pose. Needs a reference from update().
+    bool skip(const cv::Mat& gray);
+
+    // Takes `face` in the just-tracked `gray` as the new reference
+    void update(const cv::Mat& gray, const cv::Rect& face);
+
+    // Forgets the reference, e.g. when the face is lost
+    void reset();
+
+    bool  enabled = true;
+    float threshold = 2.0f;       // mean absolute difference, gray levels
+    float lastDifference = 0.0f;  // of the latest skip() check
+
+private:
+    static constexpr int kThumbSize  = 32;  // px, square
+    static constexpr int kHoldFrames = 15;  // tracked at full rate after motion
+    static constexpr int kMaxSkips   = 7;
+
+    bool thumbnail(const cv::Mat& gray, cv::Mat& out);
+
+    cv::Mat  reference, current;
+    cv::Rect region;             // of the reference, enlarged face box
+    bool     hasReference = false;
+    int      hold = 0;
+    int      skipped = 0;        // in a row since the last tracked frame
+    int      maxSkips = 1;
+};
@@ -0,0 +1,224 @@
+#include "PnP.hpp"
+#include <cmath>
+
+// Rotations are row-major 3x3 doubles internally; the fit updates them
+// multiplicatively, R <- exp(w) R, so no angle parameterisation can wrap.
+
+static void quatToMatrix(const glm::quat& q, double R[3][3]) {
+    double w = q.w, x = q.x, y = q.y, z = q.z;
+    double n = w * w + x * x + y * y + z * z;
+    double s = n > 0.0 ? 2.0 / n : 0.0;
+    R[0][0] = 1 - s * (y * y + z * z); R[0][1] = s * (x * y - w * z);     R[0][2] = s * (x * z + w * y);
+    R[1][0] = s * (x * y + w * z);     R[1][1] = 1 - s * (x * x + z * z); R[1][2] = s * (y * z - w * x);
+    R[2][0] = s * (x * z - w * y);     R[2][1] = s * (y * z + w * x);     R[2][2] = 1 - s * (x * x + y * y);
+}
+
+static glm::quat matrixToQuat(const double R[3][3]) {
+    double tr = R[0][0] + R[1][1] + R[2][2];
+    double w, x, y, z;
+    if (tr > 0.0) {
+        double s = std::sqrt(tr + 1.0) * 2.0;
+        w = 0.25 * s;
+        x = (R[2][1] - R[1][2]) / s;
+        y = (R[0][2] - R[2][0]) / s;
+        z = (R[1][0] - R[0][1]) / s;
+    } else if (R[0][0] > R[1][1] && R[0][0] > R[2][2]) {
+        double s = std::sqrt(1.0 + R[0][0] - R[1][1] - R[2][2]) * 2.0;
+        w = (R[2][1] - R[1][2]) / s;
+        x = 0.25 * s;
+        y = (R[0][1] + R[1][0]) / s;
+        z = (R[0][2] + R[2][0]) / s;
+    } else if (R[1][1] > R[2][2]) {
+        double s = std::sqrt(1.0 + R[1][1] - R[0][0] - R[2][2]) * 2.0;
+        w = (R[0][2] - R[2][0]) / s;
+        x = (R[0][1] + R[1][0]) / s;
+        y = 0.25 * s;
+        z = (R[1][2] + R[2][1]) / s;
+    } else {
+        double s = std::sqrt(1.0 + R[2][2] - R[0][0] - R[1][1]) * 2.0;
+        w = (R[1][0] - R[0][1]) / s;
+        x = (R[0][2] + R[2][0]) / s;
+        y = (R[1][2] + R[2][1]) / s;
+        z = 0.25 * s;
+    }
+    return glm::quat((float)w, (float)x, (float)y, (float)z);
+}
+
+// out = exp(w) * R (Rodrigues)
+static void rotateBy(const double w[3], const double R[3][3], double out[3][3]) {
+    double theta = std::sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+    double E[3][3];
+    if (theta < 1e-12) {
+        E[0][0] = 1;     E[0][1] = -w[2]; E[0][2] = w[1];
+        E[1][0] = w[2];  E[1][1] = 1;     E[1][2] = -w[0];
+        E[2][0] = -w[1]; E[2][1] = w[0];  E[2][2] = 1;
+    } else {
+        double k[3] = {w[0] / theta, w[1] / theta, w[2] / theta};
+        double s = std::sin(theta), c = 1.0 - std::cos(theta);
+        E[0][0] = 1 - c * (k[1] * k[1] + k[2] * k[2]);
+        E[1][1] = 1 - c * (k[0] * k[0] + k[2] * k[2]);
+        E[2][2] = 1 - c * (k[0] * k[0] + k[1] * k[1]);
+        E[0][1] = c * k[0] * k[1] - s * k[2]; E[1][0] = c * k[0] * k[1] + s * k[2];
+        E[0][2] = c * k[0] * k[2] + s * k[1]; E[2][0] = c * k[0] * k[2] - s * k[1];
+        E[1][2] = c * k[1] * k[2] - s * k[0]; E[2][1] = c * k[1] * k[2] + s * k[0];
+    }
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            out[i][j] = E[i][0] * R[0][j] + E[i][1] * R[1][j] + E[i][2] * R[2][j];
+}
+
+// Sum of squared reprojection errors; negative if a point is behind the camera
+static double reprojectionCost(const glm::vec3* model, const glm::vec2* image, int n,
+                               const PnPCamera& cam, const double R[3][3], const double t[3]) {
+    double cost = 0.0;
+    for (int p = 0; p < n; ++p) {
+        double X[3] = {model[p].x, model[p].y, model[p].z};
+        double c[3];
+        for (int i = 0; i < 3; ++i)
+            c[i] = R[i][0] * X[0] + R[i][1] * X[1] + R[i][2] * X[2] + t[i];
+        if (c[2] <= 1e-9) return -1.0;
+        double du = cam.focal * c[0] / c[2] + cam.cx - image[p].x;
+        double dv = cam.focal * c[1] / c[2] + cam.cy - image[p].y;
+        cost += du * du + dv * dv;
+    }
+    return cost;
+}
+
+// Solves A x = b for symmetric positive definite 6x6 A (Cholesky)
+static bool solve6(const double A[6][6], const double b[6], double x[6]) {
+    double L[6][6] = {};
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j <= i; ++j) {
+            double sum = A[i][j];
+            for (int k = 0; k < j; ++k) sum -= L[i][k] * L[j][k];
+            if (i == j) {
+                if (sum <= 0.0) return false;
+                L[i][i] = std::sqrt(sum);
+            } else {
+                L[i][j] = sum / L[j][j];
+            }
+        }
+    }
+    double y[6];
+    for (int i = 0; i < 6; ++i) {
+        double sum = b[i];
+        for (int k = 0; k < i; ++k) sum -= L[i][k] * y[k];
+        y[i] = sum / L[i][i];
+    }
+    for (int i = 5; i >= 0; --i) {
+        double sum = y[i];
+        for (int k = i + 1; k < 6; ++k) sum -= L[k][i] * x[k];
+        x[i] = sum / L[i][i];
+    }
+    return true;
+}
+
+bool solvePnPLM(const glm::vec3* model, const glm::vec2* image, int n,
+                const PnPCamera& cam, PnPPose& pose, int maxIterations, float* rmsError) {
+    if (n < 4 || n > kPnPMaxPoints) return false;
+
+    double R[3][3], t[3] = {pose.translation.x, pose.translation.y, pose.translation.z};
+    quatToMatrix(pose.rotation, R);
+    double cost = reprojectionCost(model, image, n, cam, R, t);
+    if (cost < 0.0) return false;
+
+    double lambda = 1e-3;
+    const double f = cam.focal;
+    for (int it = 0; it < maxIterations && cost > 1e-12; ++it) {
+        // Normal equations for the update (w, dt); d(c)/dw = -[R X]x
+        double JtJ[6][6] = {}, Jtr[6] = {};
+        for (int p = 0; p < n; ++p) {
+            double X[3] = {model[p].x, model[p].y, model[p].z};
+            double a[3], c[3];
+            for (int i = 0; i < 3; ++i) {
+                a[i] = R[i][0] * X[0] + R[i][1] * X[1] + R[i][2] * X[2];
+                c[i] = a[i] + t[i];
+            }
+            double iz = 1.0 / c[2];
+            double r[2] = {f * c[0] * iz + cam.cx - image[p].x,
+                           f * c[1] * iz + cam.cy - image[p].y};
+            double dproj[2][3] = {{f * iz, 0.0, -f * c[0] * iz * iz},
+                                  {0.0, f * iz, -f * c[1] * iz * iz}};
+            for (int k = 0; k < 2; ++k) {
+                const double* g = dproj[k];
+                double J[6] = {g[1] * -a[2] + g[2] * a[1],
+                               g[0] * a[2] + g[2] * -a[0],
+                               g[0] * -a[1] + g[1] * a[0],
+                               g[0], g[1], g[2]};
+                for (int i = 0; i < 6; ++i) {
+                    Jtr[i] += J[i] * r[k];
+                    for (int j = 0; j <= i; ++j) JtJ[i][j] += J[i] * J[j];
+                }
+            }
+        }
+        for (int i = 0; i < 6; ++i)
+            for (int j = 0; j < i; ++j) JtJ[j][i] = JtJ[i][j];
+
+        // Raise the damping until a step lowers the cost
+        bool improved = false;
+        double step2 = 0.0;
+        for (int tries = 0; tries < 8 && !improved; ++tries) {
+            double A[6][6], b[6], d[6];
+            for (int i = 0; i < 6; ++i) {
+                for (int j = 0; j < 6; ++j) A[i][j] = JtJ[i][j];
+                A[i][i] += lambda * (JtJ[i][i] + 1e-9);
+                b[i] = -Jtr[i];
+            }
+            if (!solve6(A, b, d)) { lambda *= 10.0; continue; }
+
+            double Rn[3][3], tn[3] = {t[0] + d[3], t[1] + d[4], t[2] + d[5]};
+            rotateBy(d, R, Rn);
+            double newCost = reprojectionCost(model, image, n, cam, Rn, tn);
+            if (newCost >= 0.0 && newCost < cost) {
+                for (int i = 0; i < 3; ++i) {
+                    t[i] = tn[i];
+                    for (int j = 0; j < 3; ++j) R[i][j] = Rn[i][j];
+                }
+                step2 = d[0] * d[0] + d[1] * d[1] + d[2] * d[2] +
+                        (d[3] * d[3] + d[4] * d[4] + d[5] * d[5]) / (t[2] * t[2]);
+                cost = newCost;
+                lambda = std::max(lambda * 0.1, 1e-9);
+                improved = true;
+            } else {
+                lambda *= 10.0;
+            }
+        }
+        if (!improved || step2 < 1e-14) break;
+    }
+
+    pose.rotation    = matrixToQuat(R);
+    pose.translation = glm::vec3((float)t[0], (float)t[1], (float)t[2]);
+    if (rmsError) *rmsError = (float)std::sqrt(cost / n);
+    return true;
+}
+
+PnPPose pnpFrontalGuess(const glm::vec3* model, const glm::vec2* image, int n,
+                        const PnPCamera& cam) {
+    PnPPose pose;
+    pose.rotation = glm::quat(0.0f, 1.0f, 0.0f, 0.0f);
+    if (n <= 0) return pose;
+
+    double mc[3] = {}, ic[2] = {};
+    for (int p = 0; p < n; ++p) {
+        mc[0] += model[p].x; mc[1] += model[p].y; mc[2] += model[p].z;
+        ic[0] += image[p].x; ic[1] += image[p].y;
+    }
+    for (double& v : mc) v /= n;
+    for (double& v : ic) v /= n;
+
+    // Distance from the ratio of model to image spread, ignoring depth
+    double mSpread = 0.0, iSpread = 0.0;
+    for (int p = 0; p < n; ++p) {
+        double mx = model[p].x - mc[0], my = model[p].y - mc[1];
+        double ix = image[p].x - ic[0], iy = image[p].y - ic[1];
+        mSpread += mx * mx + my * my;
+        iSpread += ix * ix + iy * iy;
+    }
+    double z = iSpread > 0.0 ? cam.focal * std::sqrt(mSpread / iSpread) : cam.focal;
+
+    // The centroid lands on the image centroid at depth z; R = diag(1, -1, -1)
+    pose.translation = glm::vec3((float)((ic[0] - cam.cx) * z / cam.focal - mc[0]),
+                                 (float)((ic[1] - cam.cy) * z / cam.focal + mc[1]),
+                                 (float)(z + mc[2]));
+    return pose;
+}
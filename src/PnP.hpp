@@ -0,0 +1,33 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Pinhole intrinsics in pixels, no lens distortion
+struct PnPCamera {
+    double focal = 1.0;
+    double cx = 0.0, cy = 0.0;
+};
+
+// Model space to camera space, in OpenCV's camera convention (x right,
+// y down, z forward): p_cam = rotation * p_model + translation
+struct PnPPose {
+    glm::quat rotation;
+    glm::vec3 translation{0.0f};
+};
+
+constexpr int kPnPMaxPoints = 16;
+
+// Levenberg-Marquardt fit of `pose` (read as the starting guess) so the
+// model points reproject onto `image`. Everything lives on the stack; meant
+// for the handful of points of a face fit, every frame. Returns false if n is
+// outside [4, kPnPMaxPoints] or a point ends up behind the camera.
+// `rmsError`, if given, receives the final reprojection error in pixels.
+bool solvePnPLM(const glm::vec3* model, const glm::vec2* image, int n,
+                const PnPCamera& cam, PnPPose& pose, int maxIterations = 10,
+                float* rmsError = nullptr);
+
+// Starting guess for when there is no previous pose: the model faces the
+// camera (half a turn about x), placed from the centroid and spread of the
+// image points.
+PnPPose pnpFrontalGuess(const glm::vec3* model, const glm::vec2* image, int n,
+                        const PnPCamera& cam);
@@ -0,0 +1,182 @@
+#include "PoseChannel.hpp"
+#include "Log.hpp"
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static constexpr uint32_t kMagic   = 0x46545053; // 'FTPS'
+static constexpr uint32_t kVersion = 1;
+
+// Bounded so the reader stays wait-free even if the writer died mid-update.
+static constexpr int kMaxReadAttempts = 4;
+
+// How long a connected reader tolerates no new frames before re-opening the
+// segment (covers a tracker that was restarted after the segment was removed).
+static constexpr auto kStaleReconnect   = std::chrono::seconds(2);
+static constexpr auto kConnectInterval  = std::chrono::milliseconds(500);
+
+// Everything lives in std::atomic so the seqlock is data-race free; payload
+// accesses are relaxed and ordered by the fences around the sequence counter.
+struct PoseChannelSegment {
+    std::atomic<uint32_t> magic;
+    std::atomic<uint32_t> version;
+    std::atomic<uint32_t> seq;          // odd while the writer is mid-update
+    std::atomic<uint32_t> faceFound;
+    std::atomic<uint64_t> timestampNs;
+    std::atomic<uint64_t> frameIndex;
+    std::atomic<uint32_t> rotation[4];  // quat w,x,y,z as float bits
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free &&
+              std::atomic<uint64_t>::is_always_lock_free,
+              "pose channel requires lock-free atomics to work across processes");
+
+static uint32_t floatBits(float f) { uint32_t u; std::memcpy(&u, &f, 4); return u; }
+static float    bitsFloat(uint32_t u) { float f; std::memcpy(&f, &u, 4); return f; }
+
+static PoseChannelSegment* mapSegment(const char* name, bool create) {
+    int fd = shm_open(name, create ? (O_CREAT | O_RDWR) : O_RDWR, 0600);
+    if (fd < 0) return nullptr;
+    if (create && ftruncate(fd, sizeof(PoseChannelSegment)) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    struct stat st{};
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(PoseChannelSegment)) {
+        close(fd);
+        return nullptr;
+    }
+    void* p = mmap(nullptr, sizeof(PoseChannelSegment),
+                   PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return nullptr;
+    return static_cast<PoseChannelSegment*>(p);
+}
+
+static void unmapSegment(PoseChannelSegment* seg) {
+    if (seg) munmap(seg, sizeof(PoseChannelSegment));
+}
+
+// ---------------------------------------------------------------------------
+// Writer
+
+PoseChannelWriter::~PoseChannelWriter() {
+    // The segment is deliberately not unlinked: a restarted tracker picks it
+    // up again and readers keep their mapping.
+    unmapSegment(seg);
+}
+
+bool PoseChannelWriter::open(const char* name) {
+    seg = mapSegment(name, true);
+    if (!seg) {
+        FT_LOG(Error, "PoseChannel: failed to create {}: {}", name, std::strerror(errno));
+        return false;
+    }
+    if (seg->magic.load() != kMagic || seg->version.load() != kVersion) {
+        // Fresh (zero-filled) or foreign segment: start over.
+        seg->seq.store(0);
+        seg->faceFound.store(0);
+        seg->timestampNs.store(0);
+        seg->frameIndex.store(0);
+        for (auto& r : seg->rotation) r.store(0);
+        seg->rotation[0].store(floatBits(1.0f));
+        seg->version.store(kVersion);
+        seg->magic.store(kMagic, std::memory_order_release);
+    }
+    // A previous tracker may have died in the middle of a write.
+    uint32_t s = seg->seq.load();
+    if (s & 1) seg->seq.store(s + 1, std::memory_order_release);
+    return true;
+}
+
+void PoseChannelWriter::publish(const PoseSample& s) {
+    if (!seg) return;
+    uint32_t seq = seg->seq.load(std::memory_order_relaxed);
+    seg->seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    seg->timestampNs.store(s.timestampNs, std::memory_order_relaxed);
+    seg->frameIndex.store(s.frameIndex,   std::memory_order_relaxed);
+    seg->faceFound.store(s.faceFound ? 1 : 0, std::memory_order_relaxed);
+    seg->rotation[0].store(floatBits(s.rotation.w), std::memory_order_relaxed);
+    seg->rotation[1].store(floatBits(s.rotation.x), std::memory_order_relaxed);
+    seg->rotation[2].store(floatBits(s.rotation.y), std::memory_order_relaxed);
+    seg->rotation[3].store(floatBits(s.rotation.z), std::memory_order_relaxed);
+
+    seg->seq.store(seq + 2, std::memory_order_release);
+}
+
+// ---------------------------------------------------------------------------
+// Reader
+
+PoseChannelReader::~PoseChannelReader() {
+    disconnect();
+}
+
+void PoseChannelReader::disconnect() {
+    unmapSegment(seg);
+    seg = nullptr;
+}
+
+void PoseChannelReader::tryConnect() {
+    auto now = std::chrono::steady_clock::now();
+    if (now < nextConnectAttempt) return;
+    nextConnectAttempt = now + kConnectInterval;
+
+    seg = mapSegment(name, false);
+    if (seg && seg->magic.load(std::memory_order_acquire) != kMagic) {
+        disconnect();
+    }
+    if (seg) lastAdvance = now;
+}
+
+bool PoseChannelReader::poll(PoseSample& out) {
+    if (!seg) tryConnect();
+
+    bool fresh = false;
+    if (seg) {
+        for (int attempt = 0; attempt < kMaxReadAttempts; ++attempt) {
+            uint32_t s0 = seg->seq.load(std::memory_order_acquire);
+            if (s0 & 1) continue;
+
+            PoseSample s;
+            s.timestampNs = seg->timestampNs.load(std::memory_order_relaxed);
+            s.frameIndex  = seg->frameIndex.load(std::memory_order_relaxed);
+            s.faceFound   = seg->faceFound.load(std::memory_order_relaxed) != 0;
+            s.rotation.w  = bitsFloat(seg->rotation[0].load(std::memory_order_relaxed));
+            s.rotation.x  = bitsFloat(seg->rotation[1].load(std::memory_order_relaxed));
+            s.rotation.y  = bitsFloat(seg->rotation[2].load(std::memory_order_relaxed));
+            s.rotation.z  = bitsFloat(seg->rotation[3].load(std::memory_order_relaxed));
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (seg->seq.load(std::memory_order_relaxed) != s0) continue;
+
+            // Only accept published, newer samples; a restarted tracker
+            // counts frames from zero again, so compare timestamps.
+            if (s.timestampNs != 0 &&
+                (!haveGood || s.timestampNs > lastGood.timestampNs)) {
+                lastGood    = s;
+                haveGood    = true;
+                fresh       = true;
+                lastAdvance = std::chrono::steady_clock::now();
+            }
+            break;
+        }
+
+        if (!fresh && std::chrono::steady_clock::now() - lastAdvance > kStaleReconnect) {
+            disconnect();
+        }
+    }
+
+    out = lastGood;
+    return fresh;
+}
+
+std::chrono::nanoseconds PoseChannelReader::age() const {
+    if (!haveGood) return std::chrono::nanoseconds::max();
+    return std::chrono::nanoseconds(poseClockNowNs() - lastGood.timestampNs);
+}
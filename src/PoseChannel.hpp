@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <chrono>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Shared-memory channel between FreeTuber-tracker (writer) and the renderer
+// (reader). A single seqlock-protected slot holds the latest pose; the writer
+// never waits on the reader and the reader never waits on the writer.
+
+// Default POSIX shared-memory object name.
+constexpr const char* kPoseChannelName = "/freetuber-pose";
+
+// One published head pose.
+struct PoseSample {
+    uint64_t  timestampNs = 0;          // steady_clock time the frame was captured
+    uint64_t  frameIndex  = 0;          // increases by one per tracked frame
+    glm::quat rotation{1, 0, 0, 0};     // same rotation estimateHead() returns
+    bool      faceFound   = false;
+};
+
+struct PoseChannelSegment;
+
+class PoseChannelWriter {
+public:
+    PoseChannelWriter() = default;
+    ~PoseChannelWriter();
+    PoseChannelWriter(const PoseChannelWriter&) = delete;
+    PoseChannelWriter& operator=(const PoseChannelWriter&) = delete;
+
+    // Creates (or re-attaches to) the segment. A restarted tracker reuses the
+    // segment left behind by the previous one, so readers never lose it.
+    bool open(const char* name = kPoseChannelName);
+    void publish(const PoseSample& s);
+
+private:
+    PoseChannelSegment* seg = nullptr;
+};
+
+class PoseChannelReader {
+public:
+    explicit PoseChannelReader(const char* name = kPoseChannelName) : name(name) {}
+    ~PoseChannelReader();
+    PoseChannelReader(const PoseChannelReader&) = delete;
+    PoseChannelReader& operator=(const PoseChannelReader&) = delete;
+
+    // Wait-free: makes a bounded number of read attempts and never blocks.
+    // Always fills `out` with the freshest consistent sample, falling back to
+    // the last good one while the tracker is missing, restarting or stalled.
+    // Returns true only if a new sample arrived since the previous poll.
+    bool poll(PoseSample& out);
+
+    bool connected() const { return seg != nullptr; }
+
+    // How old the last good sample is, or max() if none was ever read.
+    std::chrono::nanoseconds age() const;
+
+private:
+    void tryConnect();
+    void disconnect();
+
+    const char*         name;
+    PoseChannelSegment* seg  = nullptr;
+    PoseSample          lastGood;
+    bool                haveGood = false;
+    std::chrono::steady_clock::time_point nextConnectAttempt{};
+    std::chrono::steady_clock::time_point lastAdvance{};
+};
+
+// Monotonic timestamp shared by both processes.
+inline uint64_t poseClockNowNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
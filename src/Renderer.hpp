@@ -0,0 +1,51 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include <glm/glm.hpp>
+#include "VRMLoader.hpp"
+
+class SkeletonPose;
+
+// One copy of a model on screen
+struct InstanceState {
+    glm::mat4 model{1.0f};              // placement
+    const SkeletonPose* pose = nullptr; // current joints; bind pose if null
+};
+
+// Everything a backend needs to draw one frame
+struct FrameState {
+    glm::mat4 view{1.0f}, proj{1.0f};   // OpenGL clip conventions
+    // Copies of the uploaded model, drawn instanced
+    std::vector<InstanceState> instances;
+    glm::vec3 lightDir{0.5f, 1.0f, 0.3f};
+    glm::vec3 ambient{0.2f, 0.2f, 0.2f};
+};
+
+// Mesh/texture upload, pipelines and frame submission of one rendering API.
+// Backends own their pipeline state from construction on; every call is made
+// on the thread that created the backend.
+class Renderer {
+public:
+    virtual ~Renderer() = default;
+
+    virtual const char* name() const = 0;
+
+    // Uploads a parsed model, replacing the current one
+    virtual bool upload(VRMData data) = 0;
+
+    virtual void resize(int width, int height) = 0;
+
+    // Records (or replays) and submits one frame; does not present
+    virtual void drawFrame(const FrameState& frame) = 0;
+
+    // Blocks until the GPU has finished every submitted frame
+    virtual void finish() = 0;
+
+    // RGBA8 copy of the last finished frame, top row first
+    virtual bool readPixels(std::vector<unsigned char>& rgba, int& width, int& height) = 0;
+};
+
+// Offscreen Vulkan backend (null, with a logged reason, if unavailable or
+// built without Vulkan). FREETUBER_VK_DEVICE picks a device by name
+// substring, e.g. "llvmpipe" for Mesa lavapipe.
+std::unique_ptr<Renderer> createVulkanRenderer(int width, int height);
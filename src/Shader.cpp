@@ -1,12 +1,12 @@
 #include "Shader.hpp"
+#include "Log.hpp"
 #include <fstream>
 #include <sstream>
-#include <iostream>
 
 static std::string readFile(const char* path) {
     std::ifstream in(path, std::ios::binary);
     if (!in) {
-        std::cerr << "Failed to open shader: " << path << "\n";
+        FT_LOG(Error, "Failed to open shader: {}", path);
         return {};
     }
     std::ostringstream ss; ss << in.rdbuf();
@@ -22,7 +22,7 @@ static GLuint compileShader(GLenum type, const char* src) {
         GLint len; glGetShaderiv(s, GL_INFO_LOG_LENGTH, &len);
         std::string log(len, ' ');
         glGetShaderInfoLog(s, len, nullptr, &log[0]);
-        std::cerr << "Shader compile error:\n" << log << "\n";
+        FT_LOG(Error, "Shader compile error:\n{}", log);
         glDeleteShader(s);
         return 0;
     }
@@ -47,7 +47,7 @@ GLuint loadShaderProgram(const char* vPath, const char* fPath) {
         GLint len; glGetProgramiv(p, GL_INFO_LOG_LENGTH, &len);
         std::string log(len, ' ');
         glGetProgramInfoLog(p, len, nullptr, &log[0]);
-        std::cerr << "Program link error:\n" << log << "\n";
+        FT_LOG(Error, "Program link error:\n{}", log);
         glDeleteProgram(p);
         return 0;
     }
@@ -75,7 +75,7 @@ GLuint loadShaderProgramFromSource(const char* vSrc, const char* fSrc) {
         GLint len; glGetProgramiv(p, GL_INFO_LOG_LENGTH, &len);
         std::string log(len, ' ');
         glGetProgramInfoLog(p, len, nullptr, &log[0]);
-        std::cerr << "Program link error:\n" << log << "\n";
+        FT_LOG(Error, "Program link error:\n{}", log);
         glDeleteProgram(p);
         return 0;
     }
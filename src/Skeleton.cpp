@@ -0,0 +1,124 @@
+#include "Skeleton.hpp"
+#include <algorithm>
+
+static glm::mat4 composeTRS(const glm::vec3& t, const glm::quat& r, const glm::vec3& s) {
+    glm::mat4 m = glm::mat4_cast(r);
+    m[0] *= s.x;
+    m[1] *= s.y;
+    m[2] *= s.z;
+    m[3] = glm::vec4(t, 1.0f);
+    return m;
+}
+
+static glm::quat rotationOf(const glm::mat4& m) {
+    return glm::quat_cast(glm::mat3(glm::normalize(glm::vec3(m[0])),
+                                    glm::normalize(glm::vec3(m[1])),
+                                    glm::normalize(glm::vec3(m[2]))));
+}
+
+std::vector<int> Skeleton::build(const std::vector<SkeletonNode>& gltfNodes) {
+    const int n = (int)gltfNodes.size();
+
+    // glTF only stores child lists; one pass gives every node its parent
+    std::vector<int> gltfParent(n, -1);
+    for (int i = 0; i < n; ++i)
+        for (int c : gltfNodes[i].children)
+            if (c >= 0 && c < n && gltfParent[c] < 0 && c != i) gltfParent[c] = i;
+
+    // Iterative depth-first pre-order from every root
+    std::vector<int> map(n, -1), order;
+    order.reserve(n);
+    std::vector<int> stack;
+    for (int r = 0; r < n; ++r) {
+        if (gltfParent[r] >= 0) continue;
+        stack.push_back(r);
+        while (!stack.empty()) {
+            int g = stack.back();
+            stack.pop_back();
+            if (map[g] >= 0) continue;
+            map[g] = (int)order.size();
+            order.push_back(g);
+            const auto& ch = gltfNodes[g].children;
+            for (auto it = ch.rbegin(); it != ch.rend(); ++it)
+                if (*it >= 0 && *it < n && gltfParent[*it] == g) stack.push_back(*it);
+        }
+    }
+
+    const size_t count = order.size();
+    parent.assign(count, -1);
+    subtreeEnd.assign(count, 0);
+    children.assign(count, {});
+    names.resize(count);
+    restTranslation.resize(count);
+    restRotation.resize(count);
+    restScale.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const SkeletonNode& src = gltfNodes[order[i]];
+        int gp = gltfParent[order[i]];
+        parent[i]          = gp >= 0 ? map[gp] : -1;
+        names[i]           = src.name;
+        restTranslation[i] = src.translation;
+        restRotation[i]    = src.rotation;
+        restScale[i]       = src.scale;
+        if (parent[i] >= 0) children[parent[i]].push_back((int)i);
+    }
+    // Pre-order: a subtree ends where the last descendant's range ends
+    for (size_t i = count; i-- > 0; ) {
+        int end = (int)i + 1;
+        for (int c : children[i]) end = std::max(end, subtreeEnd[c]);
+        subtreeEnd[i] = end;
+    }
+
+    SkeletonPose rest(*this);
+    rest.updateWorld();
+    restWorld.resize(count);
+    for (size_t i = 0; i < count; ++i) restWorld[i] = rest.world((int)i);
+    return map;
+}
+
+SkeletonPose::SkeletonPose(const Skeleton& skeleton)
+    : skel(&skeleton),
+      translation(skeleton.restTranslation),
+      rotation(skeleton.restRotation),
+      scale(skeleton.restScale),
+      worldMats(skeleton.size(), glm::mat4(1.0f)),
+      dirty(skeleton.size(), 1) {}
+
+void SkeletonPose::setModelSpaceRotation(int node, const glm::quat& r) {
+    if (node < 0) return;
+    int p = skel->parent[node];
+    glm::quat parentRot = p >= 0 ? rotationOf(skel->restWorld[p]) : glm::quat(1, 0, 0, 0);
+    setLocalRotation(node, glm::conjugate(parentRot) * r * parentRot * skel->restRotation[node]);
+}
+
+size_t SkeletonPose::updateWorld() {
+    if (!anyDirty) return 0;
+    const int n = (int)skel->size();
+    size_t updated = 0;
+    for (int i = 0; i < n; ) {
+        if (!dirty[i]) { ++i; continue; }
+        // Everything below a dirty node moves with it
+        const int end = skel->subtreeEnd[i];
+        for (int j = i; j < end; ++j) {
+            int p = skel->parent[j];
+            glm::mat4 local = composeTRS(translation[j], rotation[j], scale[j]);
+            worldMats[j] = p >= 0 ? worldMats[p] * local : local;
+            dirty[j] = 0;
+        }
+        updated += end - i;
+        i = end;
+    }
+    anyDirty = false;
+    return updated;
+}
+
+void SkeletonPose::jointPalette(std::vector<glm::mat4>& out, std::vector<int>& skinOffset) const {
+    skinOffset.clear();
+    for (auto& skin : skel->skins) {
+        skinOffset.push_back((int)out.size());
+        for (size_t j = 0; j < skin.joints.size(); ++j) {
+            int node = skin.joints[j];
+            out.push_back(node >= 0 ? worldMats[node] * skin.inverseBind[j] : glm::mat4(1.0f));
+        }
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// One glTF node as read from the file; input to Skeleton::build()
+struct SkeletonNode {
+    std::string name;
+    std::vector<int> children;   // glTF node indices
+    glm::vec3 translation{0.0f};
+    glm::quat rotation{1, 0, 0, 0};
+    glm::vec3 scale{1.0f};
+};
+
+struct Skin {
+    std::vector<int>       joints;       // skeleton node indices
+    std::vector<glm::mat4> inverseBind;  // one per joint
+};
+
+// Flattened node hierarchy. Nodes are stored in depth-first pre-order, so
+// parent[i] < i and the subtree of i is the contiguous range
+// [i, subtreeEnd[i]). Everything that refers to nodes (meshes, skins, spring
+// bones, the head bone) uses these indices, not glTF ones.
+struct Skeleton {
+    std::vector<int>         parent;       // -1 for roots
+    std::vector<int>         subtreeEnd;
+    std::vector<std::vector<int>> children;
+    std::vector<std::string> names;
+
+    // rest pose
+    std::vector<glm::vec3>   restTranslation;
+    std::vector<glm::quat>   restRotation;
+    std::vector<glm::vec3>   restScale;
+    std::vector<glm::mat4>   restWorld;    // model space
+
+    std::vector<Skin>        skins;
+    int headNode = -1;                     // humanoid head bone, or -1
+
+    size_t size() const { return parent.size(); }
+
+    // Sorts glTF nodes into this layout and returns the glTF index -> node
+    // index mapping. Nodes not reachable from a root (cycles) are dropped
+    // and map to -1.
+    std::vector<int> build(const std::vector<SkeletonNode>& gltfNodes);
+};
+
+// Animated state of a Skeleton: local TRS per node and the model-space
+// matrices derived from them. Setting a local transform marks the node
+// dirty; updateWorld() recomputes only the dirty subtrees.
+class SkeletonPose {
+public:
+    explicit SkeletonPose(const Skeleton& skeleton);
+
+    const Skeleton& skeleton() const { return *skel; }
+
+    const glm::vec3& localTranslation(int node) const { return translation[node]; }
+    const glm::quat& localRotation(int node) const    { return rotation[node]; }
+    const glm::vec3& localScale(int node) const       { return scale[node]; }
+    void setLocalTranslation(int node, const glm::vec3& t) { translation[node] = t; markDirty(node); }
+    void setLocalRotation(int node, const glm::quat& r)    { rotation[node] = r;    markDirty(node); }
+    void setLocalScale(int node, const glm::vec3& s)       { scale[node] = s;       markDirty(node); }
+
+    // Rotates `node` about its own origin by `r`, given in model space, on
+    // top of its rest orientation.
+    void setModelSpaceRotation(int node, const glm::quat& r);
+
+    // Brings world() up to date; returns how many nodes were recomputed
+    size_t updateWorld();
+
+    const glm::mat4& world(int node) const { return worldMats[node]; }
+
+    // Appends the joint matrices of every skin to `out`; skinOffset[s] is
+    // where skin s starts in it (several poses can share one palette)
+    void jointPalette(std::vector<glm::mat4>& out, std::vector<int>& skinOffset) const;
+
+private:
+    void markDirty(int node) { dirty[node] = 1; anyDirty = true; }
+
+    const Skeleton* skel;
+    std::vector<glm::vec3>    translation;
+    std::vector<glm::quat>    rotation;
+    std::vector<glm::vec3>    scale;
+    std::vector<glm::mat4>    worldMats;
+    std::vector<unsigned char> dirty;
+    bool anyDirty = true;
+};
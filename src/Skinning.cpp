@@ -0,0 +1,16 @@
+#include "Skinning.hpp"
+
+void JointPalette::upload(const std::vector<const SkeletonPose*>& poses, StreamRing* ring) {
+    mats.clear();
+    instanceBase.clear();
+    for (const SkeletonPose* pose : poses) {
+        instanceBase.push_back((int)mats.size());
+        pose->jointPalette(mats, offsets);
+    }
+    if (mats.empty()) mats.push_back(glm::mat4(1.0f));  // keep the buffer valid
+    texels.upload(mats.data(), mats.size() * sizeof(glm::mat4), ring);
+}
+
+void JointPalette::bind(GLenum unit) const {
+    texels.bind(unit);
+}
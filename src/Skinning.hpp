@@ -0,0 +1,33 @@
+#pragma once
+#include <vector>
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include "Skeleton.hpp"
+#include "StreamRing.hpp"
+
+// Joint matrices of all skins in one texture buffer, fetched by the vertex
+// shader (uJointMats) for GPU skinning. Instances of one model each get their
+// own run of matrices.
+class JointPalette {
+public:
+    JointPalette() = default;
+    JointPalette(const JointPalette&) = delete;
+    JointPalette& operator=(const JointPalette&) = delete;
+
+    // GL thread, once per frame after the poses are final; one pose per
+    // instance, all of the same skeleton
+    void upload(const std::vector<const SkeletonPose*>& poses, StreamRing* ring = nullptr);
+    void bind(GLenum unit) const;
+
+    // First matrix of skin `skin` of instance `instance` in the buffer
+    int offset(size_t instance, int skin) const {
+        if (instance >= instanceBase.size() || skin < 0 || skin >= (int)offsets.size()) return 0;
+        return instanceBase[instance] + offsets[skin];
+    }
+
+private:
+    StreamedTexels texels;
+    std::vector<glm::mat4> mats;
+    std::vector<int>       offsets;        // per skin, within one instance
+    std::vector<int>       instanceBase;
+};
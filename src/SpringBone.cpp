@@ -0,0 +1,411 @@
+#include "SpringBone.hpp"
+#include "ThreadPool.hpp"
+#include "Log.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+// VRM 0.x bones without a child get a virtual tail this far past the tip.
+static constexpr float kVirtualTailLength = 0.07f;
+
+size_t SpringBoneDesc::jointCount() const {
+    size_t n = 0;
+    for (auto& c : chains) n += c.joints.size();
+    return n;
+}
+
+static glm::quat rotationOf(const glm::mat4& m) {
+    return glm::quat_cast(glm::mat3(glm::normalize(glm::vec3(m[0])),
+                                    glm::normalize(glm::vec3(m[1])),
+                                    glm::normalize(glm::vec3(m[2]))));
+}
+
+// Scalar quaternion helpers on loose floats so the SoA loops below stay
+// free of struct loads and vectorize.
+static inline void qmul(float ax, float ay, float az, float aw,
+                        float bx, float by, float bz, float bw,
+                        float& ox, float& oy, float& oz, float& ow) {
+    ox = aw * bx + ax * bw + ay * bz - az * by;
+    oy = aw * by - ax * bz + ay * bw + az * bx;
+    oz = aw * bz + ax * by - ay * bx + az * bw;
+    ow = aw * bw - ax * bx - ay * by - az * bz;
+}
+
+static inline void qrot(float qx, float qy, float qz, float qw,
+                        float vx, float vy, float vz,
+                        float& ox, float& oy, float& oz) {
+    // v + 2w (q x v) + 2 q x (q x v)
+    float cx = qy * vz - qz * vy;
+    float cy = qz * vx - qx * vz;
+    float cz = qx * vy - qy * vx;
+    ox = vx + 2.0f * (qw * cx + qy * cz - qz * cy);
+    oy = vy + 2.0f * (qw * cy + qz * cx - qx * cz);
+    oz = vz + 2.0f * (qw * cz + qx * cy - qy * cx);
+}
+
+void SpringBoneSystem::Island::resize(size_t n) {
+    count = n;
+    for (auto* v : {&node, &parentNode, &parentSlot}) v->assign(n, -1);
+    groupsLo.assign(n, 0);
+    groupsHi.assign(n, 0);
+    for (auto* v : {&lx, &ly, &lz, &rx, &ry, &rz, &rw, &ax, &ay, &az, &len,
+                    &stiff, &drag, &gx, &gy, &gz, &hit,
+                    &tx, &ty, &tz, &px, &py, &pz,
+                    &pqx, &pqy, &pqz, &pqw, &hx, &hy, &hz,
+                    &wqx, &wqy, &wqz, &wqw, &oqx, &oqy, &oqz, &oqw})
+        v->assign(n, 0.0f);
+}
+
+SpringBoneSystem::SpringBoneSystem(const Skeleton& skel, const SpringBoneDesc& desc,
+                                   ThreadPool* pool)
+    : pool(pool) {
+    // Collider groups become bits, so a joint/collider test is one AND
+    if (desc.colliderGroups.size() > 64)
+        FT_LOG(Warn, "SpringBone: {} collider groups, only the first 64 are used",
+               desc.colliderGroups.size());
+    for (auto& c : desc.colliders) {
+        if (c.node < 0 || c.node >= (int)skel.size()) continue;
+        colliderDefs.push_back({c.node, c.offset, c.tail, c.radius, c.capsule, 0});
+    }
+    // colliderDefs skips invalid nodes; map desc indices onto it
+    std::vector<int> colliderMap(desc.colliders.size(), -1);
+    for (size_t i = 0, k = 0; i < desc.colliders.size(); ++i) {
+        int n = desc.colliders[i].node;
+        if (n >= 0 && n < (int)skel.size()) colliderMap[i] = (int)k++;
+    }
+    for (size_t g = 0; g < desc.colliderGroups.size() && g < 64; ++g)
+        for (int ci : desc.colliderGroups[g])
+            if (ci >= 0 && ci < (int)colliderMap.size() && colliderMap[ci] >= 0)
+                colliderDefs[colliderMap[ci]].groups |= 1ull << g;
+    size_t nc = colliderDefs.size();
+    for (auto* v : {&cx0, &cy0, &cz0, &cx1, &cy1, &cz1, &cr}) v->assign(nc, 0.0f);
+
+    // Balance chains over islands, largest first
+    size_t islandCount = 1;
+    if (pool) islandCount = std::max<size_t>(1, std::min<size_t>(desc.chains.size(), pool->size() + 1));
+    std::vector<size_t> order(desc.chains.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return desc.chains[a].joints.size() > desc.chains[b].joints.size();
+    });
+    std::vector<std::vector<size_t>> islandChains(islandCount);
+    std::vector<size_t> load(islandCount, 0);
+    for (size_t c : order) {
+        size_t i = std::min_element(load.begin(), load.end()) - load.begin();
+        islandChains[i].push_back(c);
+        load[i] += desc.chains[c].joints.size();
+    }
+
+    for (auto& chains : islandChains) {
+        // (depth, chain, joint), sorted so every parent precedes its children
+        struct Entry { int depth; size_t chain, joint; };
+        std::vector<Entry> entries;
+        for (size_t c : chains) {
+            auto& js = desc.chains[c].joints;
+            std::vector<int> depth(js.size(), 0);
+            for (size_t j = 0; j < js.size(); ++j) {
+                int p = js[j].parent;
+                if (p >= 0 && p < (int)j) depth[j] = depth[p] + 1;
+                if (js[j].node >= 0 && js[j].node < (int)skel.size())
+                    entries.push_back({depth[j], c, j});
+            }
+        }
+        if (entries.empty()) continue;
+        std::stable_sort(entries.begin(), entries.end(),
+                         [](const Entry& a, const Entry& b) { return a.depth < b.depth; });
+
+        Island is;
+        is.resize(entries.size());
+        std::vector<std::vector<int>> slotOf(desc.chains.size());
+        for (size_t c : chains) slotOf[c].assign(desc.chains[c].joints.size(), -1);
+
+        for (size_t s = 0; s < entries.size(); ++s) {
+            const Entry& e = entries[s];
+            if (s == 0 || entries[s - 1].depth != e.depth) is.levelStart.push_back(s);
+            slotOf[e.chain][e.joint] = (int)s;
+
+            const SpringChainDesc& chain = desc.chains[e.chain];
+            const SpringJointDesc& j     = chain.joints[e.joint];
+            const int              nodeParent = skel.parent[j.node];
+
+            is.node[s]       = j.node;
+            is.parentNode[s] = nodeParent;
+            // Chain parents are only used if they really are the skeleton
+            // parent; anything else is read back from the pose.
+            if (j.parent >= 0 && slotOf[e.chain][j.parent] >= 0 &&
+                chain.joints[j.parent].node == nodeParent)
+                is.parentSlot[s] = slotOf[e.chain][j.parent];
+
+            const glm::vec3& t = skel.restTranslation[j.node];
+            const glm::quat& r = skel.restRotation[j.node];
+            is.lx[s] = t.x; is.ly[s] = t.y; is.lz[s] = t.z;
+            is.rx[s] = r.x; is.ry[s] = r.y; is.rz[s] = r.z; is.rw[s] = r.w;
+
+            // Bone direction and length from the rest pose, in the joint's
+            // rotation-only frame
+            glm::vec3 head = glm::vec3(skel.restWorld[j.node][3]);
+            glm::vec3 tail;
+            if (j.tailNode >= 0 && j.tailNode < (int)skel.size()) {
+                tail = glm::vec3(skel.restWorld[j.tailNode][3]);
+            } else {
+                glm::vec3 from = nodeParent >= 0 ? glm::vec3(skel.restWorld[nodeParent][3]) : head;
+                glm::vec3 dir  = head - from;
+                float     l    = glm::length(dir);
+                tail = head + (l > 1e-6f ? dir / l : glm::vec3(0, -1, 0)) * kVirtualTailLength;
+            }
+            glm::vec3 bone = tail - head;
+            float     l    = glm::length(bone);
+            glm::vec3 axis = glm::conjugate(rotationOf(skel.restWorld[j.node])) *
+                             (l > 1e-6f ? bone / l : glm::vec3(0, -1, 0));
+            is.ax[s] = axis.x; is.ay[s] = axis.y; is.az[s] = axis.z;
+            is.len[s] = std::max(l, 1e-4f);
+
+            glm::vec3 g = j.gravityDir * j.gravityPower;
+            is.gx[s] = g.x; is.gy[s] = g.y; is.gz[s] = g.z;
+            is.stiff[s] = j.stiffness;
+            is.drag[s]  = std::clamp(j.dragForce, 0.0f, 1.0f);
+            is.hit[s]   = j.hitRadius;
+
+            for (int g : chain.colliderGroups) {
+                if (g >= 0 && g < 32)      is.groupsLo[s] |= 1u << g;
+                else if (g >= 32 && g < 64) is.groupsHi[s] |= 1u << (g - 32);
+            }
+        }
+        is.levelStart.push_back(entries.size());
+        joints += is.count;
+        islands.push_back(std::move(is));
+    }
+
+    if (joints)
+        FT_LOG(Info, "SpringBone: {} joints, {} colliders, {} islands",
+               joints, colliderDefs.size(), islands.size());
+}
+
+void SpringBoneSystem::gatherParents(Island& is, size_t b, size_t e,
+                                     const SkeletonPose& pose) const {
+    for (size_t j = b; j < e; ++j) {
+        int ps = is.parentSlot[j];
+        if (ps >= 0) {
+            is.pqx[j] = is.wqx[ps]; is.pqy[j] = is.wqy[ps];
+            is.pqz[j] = is.wqz[ps]; is.pqw[j] = is.wqw[ps];
+            float ox, oy, oz;
+            qrot(is.pqx[j], is.pqy[j], is.pqz[j], is.pqw[j],
+                 is.lx[j], is.ly[j], is.lz[j], ox, oy, oz);
+            is.hx[j] = is.hx[ps] + ox; is.hy[j] = is.hy[ps] + oy; is.hz[j] = is.hz[ps] + oz;
+        } else {
+            glm::mat4 m = is.parentNode[j] >= 0 ? pose.world(is.parentNode[j]) : glm::mat4(1.0f);
+            glm::quat q = rotationOf(m);
+            glm::vec4 h = m * glm::vec4(is.lx[j], is.ly[j], is.lz[j], 1.0f);
+            is.pqx[j] = q.x; is.pqy[j] = q.y; is.pqz[j] = q.z; is.pqw[j] = q.w;
+            is.hx[j] = h.x; is.hy[j] = h.y; is.hz[j] = h.z;
+        }
+    }
+}
+
+void SpringBoneSystem::updateColliders(const SkeletonPose& pose) {
+    for (size_t c = 0; c < colliderDefs.size(); ++c) {
+        const Collider& d = colliderDefs[c];
+        const glm::mat4& m = pose.world(d.node);
+        glm::vec4 a = m * glm::vec4(d.offset, 1.0f);
+        glm::vec4 b = d.capsule ? m * glm::vec4(d.tail, 1.0f) : a;
+        cx0[c] = a.x; cy0[c] = a.y; cz0[c] = a.z;
+        cx1[c] = b.x; cy1[c] = b.y; cz1[c] = b.z;
+        cr[c]  = d.radius;
+    }
+}
+
+void SpringBoneSystem::reset(const SkeletonPose& pose) {
+    for (auto& is : islands) {
+        for (size_t l = 0; l + 1 < is.levelStart.size(); ++l) {
+            size_t b = is.levelStart[l], e = is.levelStart[l + 1];
+            gatherParents(is, b, e, pose);
+            for (size_t j = b; j < e; ++j) {
+                qmul(is.pqx[j], is.pqy[j], is.pqz[j], is.pqw[j],
+                     is.rx[j], is.ry[j], is.rz[j], is.rw[j],
+                     is.wqx[j], is.wqy[j], is.wqz[j], is.wqw[j]);
+                float dx, dy, dz;
+                qrot(is.wqx[j], is.wqy[j], is.wqz[j], is.wqw[j],
+                     is.ax[j], is.ay[j], is.az[j], dx, dy, dz);
+                is.tx[j] = is.px[j] = is.hx[j] + dx * is.len[j];
+                is.ty[j] = is.py[j] = is.hy[j] + dy * is.len[j];
+                is.tz[j] = is.pz[j] = is.hz[j] + dz * is.len[j];
+                is.oqx[j] = is.rx[j]; is.oqy[j] = is.ry[j];
+                is.oqz[j] = is.rz[j]; is.oqw[j] = is.rw[j];
+            }
+        }
+    }
+    accumulator = 0.0f;
+    needsReset  = false;
+}
+
+void SpringBoneSystem::stepIsland(Island& is, const SkeletonPose& pose, float dt) const {
+    const size_t nc = colliderDefs.size();
+
+    for (size_t l = 0; l + 1 < is.levelStart.size(); ++l) {
+        const size_t b = is.levelStart[l], e = is.levelStart[l + 1];
+        gatherParents(is, b, e, pose);
+
+        float* __restrict tx = is.tx.data();
+        float* __restrict ty = is.ty.data();
+        float* __restrict tz = is.tz.data();
+        float* __restrict px = is.px.data();
+        float* __restrict py = is.py.data();
+        float* __restrict pz = is.pz.data();
+        float* __restrict wqx = is.wqx.data();
+        float* __restrict wqy = is.wqy.data();
+        float* __restrict wqz = is.wqz.data();
+        float* __restrict wqw = is.wqw.data();
+        const float* __restrict hx = is.hx.data();
+        const float* __restrict hy = is.hy.data();
+        const float* __restrict hz = is.hz.data();
+        const float* __restrict len = is.len.data();
+
+        // Verlet step + length constraint. wq temporarily holds the world
+        // rest rotation.
+        #pragma omp simd
+        for (size_t j = b; j < e; ++j) {
+            float rx_, ry_, rz_, rw_;
+            qmul(is.pqx[j], is.pqy[j], is.pqz[j], is.pqw[j],
+                 is.rx[j], is.ry[j], is.rz[j], is.rw[j], rx_, ry_, rz_, rw_);
+            wqx[j] = rx_; wqy[j] = ry_; wqz[j] = rz_; wqw[j] = rw_;
+
+            float dx, dy, dz;
+            qrot(rx_, ry_, rz_, rw_, is.ax[j], is.ay[j], is.az[j], dx, dy, dz);
+
+            float k     = 1.0f - is.drag[j];
+            float stiff = is.stiff[j] * dt;
+            float nx = tx[j] + (tx[j] - px[j]) * k + dx * stiff + is.gx[j] * dt;
+            float ny = ty[j] + (ty[j] - py[j]) * k + dy * stiff + is.gy[j] * dt;
+            float nz = tz[j] + (tz[j] - pz[j]) * k + dz * stiff + is.gz[j] * dt;
+
+            float ox = nx - hx[j], oy = ny - hy[j], oz = nz - hz[j];
+            float s  = len[j] / std::sqrt(ox * ox + oy * oy + oz * oz + 1e-12f);
+            px[j] = tx[j]; py[j] = ty[j]; pz[j] = tz[j];
+            tx[j] = hx[j] + ox * s;
+            ty[j] = hy[j] + oy * s;
+            tz[j] = hz[j] + oz * s;
+        }
+
+        // Colliders: a sphere is a capsule whose ends coincide
+        for (size_t c = 0; c < nc; ++c) {
+            const uint32_t cgLo = (uint32_t)colliderDefs[c].groups;
+            const uint32_t cgHi = (uint32_t)(colliderDefs[c].groups >> 32);
+            const float ax = cx0[c], ay = cy0[c], az = cz0[c];
+            const float sx = cx1[c] - ax, sy = cy1[c] - ay, sz = cz1[c] - az;
+            const float seg2 = std::max(sx * sx + sy * sy + sz * sz, 1e-12f);
+            const float radius = cr[c];
+            const uint32_t* __restrict groupsLo = is.groupsLo.data();
+            const uint32_t* __restrict groupsHi = is.groupsHi.data();
+            const float* __restrict hit = is.hit.data();
+
+            #pragma omp simd
+            for (size_t j = b; j < e; ++j) {
+                float t = ((tx[j] - ax) * sx + (ty[j] - ay) * sy + (tz[j] - az) * sz) / seg2;
+                t = std::min(std::max(t, 0.0f), 1.0f);
+                float dx = tx[j] - (ax + sx * t);
+                float dy = ty[j] - (ay + sy * t);
+                float dz = tz[j] - (az + sz * t);
+                float d2 = dx * dx + dy * dy + dz * dz;
+                float r  = radius + hit[j];
+                float d  = std::sqrt(d2) + 1e-6f;
+                float push = (r - d) / d;
+                push = d2 < r * r ? push : 0.0f;
+                push = ((groupsLo[j] & cgLo) | (groupsHi[j] & cgHi)) ? push : 0.0f;
+                tx[j] += dx * push;
+                ty[j] += dy * push;
+                tz[j] += dz * push;
+            }
+        }
+
+        // Re-apply the length constraint and turn the bone towards its tail
+        #pragma omp simd
+        for (size_t j = b; j < e; ++j) {
+            float ox = tx[j] - hx[j], oy = ty[j] - hy[j], oz = tz[j] - hz[j];
+            float inv = 1.0f / std::sqrt(ox * ox + oy * oy + oz * oz + 1e-12f);
+            ox *= inv; oy *= inv; oz *= inv;
+            tx[j] = hx[j] + ox * len[j];
+            ty[j] = hy[j] + oy * len[j];
+            tz[j] = hz[j] + oz * len[j];
+
+            float fx, fy, fz;
+            qrot(wqx[j], wqy[j], wqz[j], wqw[j], is.ax[j], is.ay[j], is.az[j], fx, fy, fz);
+
+            // shortest arc from the rest direction to the simulated one
+            float qw = std::max(1.0f + fx * ox + fy * oy + fz * oz, 1e-6f);
+            float qx = fy * oz - fz * oy;
+            float qy = fz * ox - fx * oz;
+            float qz = fx * oy - fy * ox;
+            float qn = 1.0f / std::sqrt(qx * qx + qy * qy + qz * qz + qw * qw);
+            qx *= qn; qy *= qn; qz *= qn; qw *= qn;
+
+            float wx, wy, wz, ww;
+            qmul(qx, qy, qz, qw, wqx[j], wqy[j], wqz[j], wqw[j], wx, wy, wz, ww);
+            wqx[j] = wx; wqy[j] = wy; wqz[j] = wz; wqw[j] = ww;
+
+            // local = conj(parent) * world
+            qmul(-is.pqx[j], -is.pqy[j], -is.pqz[j], is.pqw[j], wx, wy, wz, ww,
+                 is.oqx[j], is.oqy[j], is.oqz[j], is.oqw[j]);
+        }
+    }
+}
+
+void SpringBoneSystem::step(const SkeletonPose& pose) {
+    auto t0 = std::chrono::steady_clock::now();
+    updateColliders(pose);
+    if (pool && islands.size() > 1) {
+        pool->parallelFor(islands.size(), [&](size_t i) {
+            stepIsland(islands[i], pose, kTimeStep);
+        });
+    } else {
+        for (auto& is : islands) stepIsland(is, pose, kTimeStep);
+    }
+    stepMs += std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - t0).count();
+    ++stepCount;
+}
+
+void SpringBoneSystem::writePose(SkeletonPose& pose) const {
+    for (auto& is : islands)
+        for (size_t j = 0; j < is.count; ++j)
+            pose.setLocalRotation(is.node[j],
+                                  glm::quat(is.oqw[j], is.oqx[j], is.oqy[j], is.oqz[j]));
+}
+
+void SpringBoneSystem::update(float dt, SkeletonPose& pose) {
+    if (!joints) return;
+    if (needsReset) reset(pose);
+
+    // Clamp long frames (window drag, model swap) instead of spiralling
+    accumulator += std::min(dt, kTimeStep * kMaxSubsteps);
+    int steps = 0;
+    while (accumulator >= kTimeStep && steps < kMaxSubsteps) {
+        step(pose);
+        accumulator -= kTimeStep;
+        ++steps;
+    }
+    if (steps) writePose(pose);
+
+    if (FT_LOG_ON(Debug) && stepMs >= 1000.0) {
+        FT_LOG(Debug, "SpringBone: {} joints, {} ms/step, {} joints/ms",
+               joints, stepMs / stepCount, joints * stepCount / stepMs);
+        stepMs = 0.0;
+        stepCount = 0;
+    }
+}
+
+double benchmarkSpringBones(const Skeleton& skeleton, const SpringBoneDesc& desc,
+                            ThreadPool* pool, int steps) {
+    SkeletonPose pose(skeleton);
+    pose.updateWorld();
+    SpringBoneSystem sys(skeleton, desc, pool);
+    if (!sys.jointCount() || steps <= 0) return 0.0;
+    sys.reset(pose);
+    for (int i = 0; i < 16; ++i) sys.step(pose);
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < steps; ++i) sys.step(pose);
+    double ms = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - t0).count();
+    return sys.jointCount() * (double)steps / std::max(ms, 1e-6);
+}
@@ -0,0 +1,133 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+#include "Skeleton.hpp"
+
+class ThreadPool;
+
+// Spring-bone setup read from the VRM 0.x secondaryAnimation or the VRM 1.0
+// VRMC_springBone extension, normalized to one form.
+struct SpringColliderDesc {
+    int       node = -1;
+    glm::vec3 offset{0.0f};   // node-local
+    float     radius = 0.0f;
+    bool      capsule = false;
+    glm::vec3 tail{0.0f};     // node-local capsule end
+};
+
+struct SpringJointDesc {
+    int   node = -1;
+    int   parent = -1;        // index of the parent joint in the chain, or -1
+    int   tailNode = -1;      // node the bone points at; -1 extends past the tip
+    float stiffness = 1.0f;
+    float gravityPower = 0.0f;
+    glm::vec3 gravityDir{0.0f, -1.0f, 0.0f};
+    float dragForce = 0.4f;
+    float hitRadius = 0.02f;
+};
+
+// An independent tree of joints (a strand of hair, a skirt panel). Parents
+// always come before their children.
+struct SpringChainDesc {
+    std::vector<SpringJointDesc> joints;
+    std::vector<int>             colliderGroups;
+};
+
+struct SpringBoneDesc {
+    std::vector<SpringColliderDesc> colliders;
+    std::vector<std::vector<int>>   colliderGroups;  // collider indices
+    std::vector<SpringChainDesc>    chains;
+
+    size_t jointCount() const;
+};
+
+// Verlet spring-bone simulation on a fixed timestep, independent of the
+// render rate. Joints are stored structure-of-arrays and processed one tree
+// level at a time, so the integration and collision loops vectorize; chains
+// are split into islands that can run on a thread pool.
+class SpringBoneSystem {
+public:
+    static constexpr float kTimeStep    = 1.0f / 60.0f;
+    static constexpr int   kMaxSubsteps = 4;
+
+    // `pool` may be null to simulate on the calling thread
+    SpringBoneSystem(const Skeleton& skeleton, const SpringBoneDesc& desc,
+                     ThreadPool* pool = nullptr);
+
+    // Puts every bone back at rest relative to `pose` (world must be current)
+    void reset(const SkeletonPose& pose);
+
+    // Advances the simulation by `dt` seconds and writes the joints' local
+    // rotations into `pose`. pose.world must be current on entry; call
+    // pose.updateWorld() afterwards.
+    void update(float dt, SkeletonPose& pose);
+
+    // One fixed step without touching the accumulator (benchmarks)
+    void step(const SkeletonPose& pose);
+    void writePose(SkeletonPose& pose) const;
+
+    size_t jointCount() const { return joints; }
+    size_t islandCount() const { return islands.size(); }
+
+private:
+    struct Collider {
+        int       node;
+        glm::vec3 offset, tail;
+        float     radius;
+        bool      capsule;
+        uint64_t  groups;      // bit per collider group
+    };
+
+    // Joints of a set of chains, sorted by depth. Hot per-joint state lives in
+    // parallel float arrays.
+    struct Island {
+        size_t              count = 0;
+        std::vector<size_t> levelStart;        // joints [levelStart[i], levelStart[i+1])
+
+        std::vector<int>      node, parentNode, parentSlot;
+        // collider group bits, split in halves so the test stays 32-bit wide
+        std::vector<uint32_t> groupsLo, groupsHi;
+
+        // rest data
+        std::vector<float> lx, ly, lz;         // local translation
+        std::vector<float> rx, ry, rz, rw;     // local rest rotation
+        std::vector<float> ax, ay, az, len;    // bone axis (local, unit) and length
+        std::vector<float> stiff, drag, gx, gy, gz, hit;
+
+        // simulation state (model space)
+        std::vector<float> tx, ty, tz;         // current tail
+        std::vector<float> px, py, pz;         // previous tail
+
+        // per-step scratch
+        std::vector<float> pqx, pqy, pqz, pqw; // parent world rotation
+        std::vector<float> hx, hy, hz;         // bone head position
+        std::vector<float> wqx, wqy, wqz, wqw; // world rotation
+        std::vector<float> oqx, oqy, oqz, oqw; // resulting local rotation
+
+        void resize(size_t n);
+    };
+
+    void stepIsland(Island& is, const SkeletonPose& pose, float dt) const;
+    void gatherParents(Island& is, size_t b, size_t e, const SkeletonPose& pose) const;
+    void updateColliders(const SkeletonPose& pose);
+
+    std::vector<Island>   islands;
+    std::vector<Collider> colliderDefs;
+    // world-space collider shapes for the current step
+    std::vector<float>    cx0, cy0, cz0, cx1, cy1, cz1, cr;
+
+    ThreadPool* pool;
+    size_t      joints = 0;
+    float       accumulator = 0.0f;
+    bool        needsReset = true;
+
+    // stats
+    uint64_t stepCount = 0;
+    double   stepMs = 0.0;
+};
+
+// Simulates `steps` fixed steps of `desc` on the model's rest pose and
+// returns joints processed per millisecond.
+double benchmarkSpringBones(const Skeleton& skeleton, const SpringBoneDesc& desc,
+                            ThreadPool* pool, int steps);
@@ -0,0 +1,33 @@
+#include "Startup.hpp"
+#include "Log.hpp"
+#include <algorithm>
+
+void StartupTimeline::record(const std::string& stage, Clock::time_point begin) {
+    record(stage, begin, Clock::now());
+}
+
+void StartupTimeline::record(const std::string& stage, Clock::time_point begin,
+                             Clock::time_point end) {
+    double startMs = std::chrono::duration<double, std::milli>(begin - t0).count();
+    double durMs   = std::chrono::duration<double, std::milli>(end - begin).count();
+    std::lock_guard<std::mutex> lock(mtx);
+    stages.push_back({stage, startMs, durMs});
+}
+
+void StartupTimeline::report(const char* title) const {
+    double totalMs = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    std::vector<Stage> sorted;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        sorted = stages;
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const Stage& a, const Stage& b) { return a.startMs < b.startMs; });
+
+    FT_LOG(Info, "{}: {} ms", title, totalMs);
+    for (auto& s : sorted) {
+        FT_LOG(Info, "  {} : {} ms (at {} .. {} ms)", s.name, s.durationMs,
+               s.startMs, s.startMs + s.durationMs);
+    }
+}
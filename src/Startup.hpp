@@ -0,0 +1,35 @@
+#pragma once
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Collects how long each startup stage took and when it finished, from any
+// thread, and logs a "time to first frame" breakdown once the first frame is
+// on screen. Stages that overlap on worker threads show up as such.
+class StartupTimeline {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    StartupTimeline() : t0(Clock::now()) {}
+
+    Clock::time_point now() const { return Clock::now(); }
+
+    // Stage ran from `begin` until now
+    void record(const std::string& stage, Clock::time_point begin);
+    // Stage timed elsewhere, e.g. inside a worker
+    void record(const std::string& stage, Clock::time_point begin, Clock::time_point end);
+
+    // Logs every stage plus total time to first frame
+    void report(const char* title) const;
+
+private:
+    struct Stage {
+        std::string name;
+        double      startMs, durationMs;
+    };
+
+    Clock::time_point  t0;
+    mutable std::mutex mtx;
+    std::vector<Stage> stages;
+};
@@ -0,0 +1,97 @@
+#include "StreamRing.hpp"
+#include "GL45.hpp"
+#include "Log.hpp"
+#include <cstring>
+
+StreamRing::StreamRing(size_t bytesPerFrame) : frameBytes(bytesPerFrame) {
+    if (!haveGL45()) return;
+    GLint a = 0;
+    glGetIntegerv(GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, &a);
+    if (a > 0) align = (size_t)a;
+    frameBytes = (frameBytes + align - 1) / align * align;
+
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    gl45.createBuffers(1, &buf);
+    gl45.namedBufferStorage(buf, frameBytes * kFrames, nullptr, flags);
+    base = (char*)gl45.mapNamedBufferRange(buf, 0, frameBytes * kFrames, flags);
+    if (!base) {
+        FT_LOG(Warn, "StreamRing: persistent map failed, per-frame data uses glBufferSubData");
+        glDeleteBuffers(1, &buf);
+        buf = 0;
+    }
+}
+
+StreamRing::~StreamRing() {
+    for (GLsync f : fences) if (f) glDeleteSync(f);
+    // Deleting a buffer unmaps it
+    if (buf) glDeleteBuffers(1, &buf);
+}
+
+void StreamRing::beginFrame() {
+    if (!base) return;
+    frame = (frame + 1) % kFrames;
+    used = 0;
+    if (GLsync f = fences[frame]) {
+        // Normally already signalled: the region was last used kFrames ago
+        while (glClientWaitSync(f, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED) {}
+        glDeleteSync(f);
+        fences[frame] = nullptr;
+    }
+}
+
+void StreamRing::endFrame() {
+    if (!base || fences[frame]) return;
+    fences[frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void* StreamRing::alloc(size_t bytes, GLintptr& offset) {
+    if (!base) return nullptr;
+    size_t start = (used + align - 1) / align * align;
+    if (start + bytes > frameBytes) return nullptr;
+    used = start + bytes;
+    offset = (GLintptr)(frame * frameBytes + start);
+    return base + offset;
+}
+
+StreamedTexels::~StreamedTexels() {
+    if (texture) glDeleteTextures(1, &texture);
+    if (buffer)  glDeleteBuffers(1, &buffer);
+}
+
+void StreamedTexels::upload(const void* data, size_t bytes, StreamRing* ring) {
+    if (!texture) {
+        // DSA calls need a created object, not just a generated name
+        if (haveGL45()) gl45.createTextures(GL_TEXTURE_BUFFER, 1, &texture);
+        else            glGenTextures(1, &texture);
+    }
+
+    GLintptr offset = 0;
+    if (void* dst = ring ? ring->alloc(bytes, offset) : nullptr) {
+        std::memcpy(dst, data, bytes);
+        gl45.textureBufferRange(texture, GL_RGBA32F, ring->buffer(), offset, (GLsizeiptr)bytes);
+        onRing = true;
+        return;
+    }
+
+    if (!buffer) glGenBuffers(1, &buffer);
+    glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+    bool grow = bytes > capacity;
+    if (grow) {
+        glBufferData(GL_TEXTURE_BUFFER, bytes, data, GL_STREAM_DRAW);
+        capacity = bytes;
+    } else {
+        glBufferSubData(GL_TEXTURE_BUFFER, 0, bytes, data);
+    }
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+    if (grow || onRing) {
+        glBindTexture(GL_TEXTURE_BUFFER, texture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, buffer);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+        onRing = false;
+    }
+}
+
+void StreamedTexels::bind(GLenum unit) const {
+    glActiveTexture(unit);
+    glBindTexture(GL_TEXTURE_BUFFER, texture);
+}
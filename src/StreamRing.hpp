@@ -0,0 +1,55 @@
+#pragma once
+#include <cstddef>
+#include <glad/glad.h>
+
+// Per-frame data (joint palette, draw table) written straight into a
+// persistently mapped buffer (GL 4.5). The buffer holds kFrames regions used
+// round robin; a fence per region keeps the CPU from overwriting data the GPU
+// may still read.
+class StreamRing {
+public:
+    static constexpr int kFrames = 3;
+
+    explicit StreamRing(size_t bytesPerFrame);
+    ~StreamRing();
+    StreamRing(const StreamRing&) = delete;
+    StreamRing& operator=(const StreamRing&) = delete;
+
+    // False without GL 4.5 or if mapping failed; callers keep their own buffers
+    bool valid() const { return base != nullptr; }
+    GLuint buffer() const { return buf; }
+
+    // Waits for the GPU to release the region about to be reused
+    void beginFrame();
+    // Fences everything written since beginFrame
+    void endFrame();
+
+    // Space for `bytes` in this frame's region, or nullptr when it is full
+    void* alloc(size_t bytes, GLintptr& offset);
+
+private:
+    GLuint  buf = 0;
+    char*   base = nullptr;
+    size_t  frameBytes, align = 256;
+    size_t  used = 0;
+    int     frame = 0;
+    GLsync  fences[kFrames] = {};
+};
+
+// RGBA32F buffer texture whose contents are replaced every frame. Streams
+// through the ring when it has room, else through its own buffer.
+class StreamedTexels {
+public:
+    StreamedTexels() = default;
+    ~StreamedTexels();
+    StreamedTexels(const StreamedTexels&) = delete;
+    StreamedTexels& operator=(const StreamedTexels&) = delete;
+
+    void upload(const void* data, size_t bytes, StreamRing* ring);
+    void bind(GLenum unit) const;
+
+private:
+    GLuint buffer = 0, texture = 0;
+    size_t capacity = 0;
+    bool   onRing = false;
+};
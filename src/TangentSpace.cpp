@@ -0,0 +1,206 @@
+#include "TangentSpace.hpp"
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <glm/glm.hpp>
+#ifdef FT_HAVE_MIKKTSPACE
+#include <mikktspace.h>
+#endif
+
+static glm::vec3 vec3At(const std::vector<float>& v, size_t vertex, const VertexLayout& l, size_t off) {
+    const float* p = &v[vertex * l.stride + off];
+    return {p[0], p[1], p[2]};
+}
+
+// glTF puts the UV origin top-left; MikkTSpace (and the tools that bake
+// normal maps with it) expect it bottom-left.
+static glm::vec2 uvAt(const std::vector<float>& v, size_t vertex, const VertexLayout& l) {
+    const float* p = &v[vertex * l.stride + l.uv];
+    return {p[0], 1.0f - p[1]};
+}
+
+void generateSmoothNormals(std::vector<float>& verts, const VertexLayout& l,
+                           const std::vector<uint32_t>& indices) {
+    const size_t n = verts.size() / l.stride;
+
+    // Weld by exact position
+    struct Key {
+        uint32_t x, y, z;
+        bool operator==(const Key& o) const { return x == o.x && y == o.y && z == o.z; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& k) const {
+            return (size_t)k.x * 73856093u ^ (size_t)k.y * 19349663u ^ (size_t)k.z * 83492791u;
+        }
+    };
+    std::unordered_map<Key, uint32_t, KeyHash> weld;
+    weld.reserve(n);
+    std::vector<uint32_t> group(n);
+    for (size_t i = 0; i < n; ++i) {
+        Key k;
+        std::memcpy(&k, &verts[i * l.stride + l.position], sizeof(k));
+        group[i] = weld.emplace(k, (uint32_t)weld.size()).first->second;
+    }
+
+    std::vector<glm::vec3> sum(weld.size(), glm::vec3(0.0f));
+    for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+        uint32_t a = indices[t], b = indices[t + 1], c = indices[t + 2];
+        if (a >= n || b >= n || c >= n) continue;
+        glm::vec3 pa = vec3At(verts, a, l, l.position);
+        // Unnormalized cross product: larger faces weigh more
+        glm::vec3 fn = glm::cross(vec3At(verts, b, l, l.position) - pa,
+                                  vec3At(verts, c, l, l.position) - pa);
+        sum[group[a]] += fn;
+        sum[group[b]] += fn;
+        sum[group[c]] += fn;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        glm::vec3 s = sum[group[i]];
+        float len = glm::length(s);
+        glm::vec3 nrm = len > 1e-20f ? s / len : glm::vec3(0, 1, 0);
+        float* p = &verts[i * l.stride + l.normal];
+        p[0] = nrm.x; p[1] = nrm.y; p[2] = nrm.z;
+    }
+}
+
+#ifdef FT_HAVE_MIKKTSPACE
+
+namespace {
+struct MikkMesh {
+    const std::vector<float>*    verts;
+    const std::vector<uint32_t>* indices;
+    const VertexLayout*          layout;
+    std::vector<float>           corners;   // 4 floats per face corner
+};
+}
+
+static MikkMesh& mesh(const SMikkTSpaceContext* ctx) {
+    return *static_cast<MikkMesh*>(ctx->m_pUserData);
+}
+static int mikkNumFaces(const SMikkTSpaceContext* ctx) {
+    return (int)(mesh(ctx).indices->size() / 3);
+}
+static int mikkNumVerticesOfFace(const SMikkTSpaceContext*, const int) {
+    return 3;
+}
+static void mikkPosition(const SMikkTSpaceContext* ctx, float out[], const int face, const int vert) {
+    MikkMesh& m = mesh(ctx);
+    glm::vec3 p = vec3At(*m.verts, (*m.indices)[face * 3 + vert], *m.layout, m.layout->position);
+    out[0] = p.x; out[1] = p.y; out[2] = p.z;
+}
+static void mikkNormal(const SMikkTSpaceContext* ctx, float out[], const int face, const int vert) {
+    MikkMesh& m = mesh(ctx);
+    glm::vec3 p = vec3At(*m.verts, (*m.indices)[face * 3 + vert], *m.layout, m.layout->normal);
+    out[0] = p.x; out[1] = p.y; out[2] = p.z;
+}
+static void mikkTexCoord(const SMikkTSpaceContext* ctx, float out[], const int face, const int vert) {
+    MikkMesh& m = mesh(ctx);
+    glm::vec2 uv = uvAt(*m.verts, (*m.indices)[face * 3 + vert], *m.layout);
+    out[0] = uv.x; out[1] = uv.y;
+}
+static void mikkSetTSpaceBasic(const SMikkTSpaceContext* ctx, const float t[], const float sign,
+                               const int face, const int vert) {
+    float* c = &mesh(ctx).corners[(face * 3 + vert) * 4];
+    c[0] = t[0]; c[1] = t[1]; c[2] = t[2]; c[3] = sign;
+}
+
+void generateTangents(std::vector<float>& verts, const VertexLayout& l,
+                      std::vector<uint32_t>& indices) {
+    const size_t n = verts.size() / l.stride;
+    for (uint32_t i : indices) if (i >= n) return;
+
+    MikkMesh m{&verts, &indices, &l, std::vector<float>(indices.size() / 3 * 3 * 4, 0.0f)};
+    SMikkTSpaceInterface iface{};
+    iface.m_getNumFaces          = mikkNumFaces;
+    iface.m_getNumVerticesOfFace = mikkNumVerticesOfFace;
+    iface.m_getPosition          = mikkPosition;
+    iface.m_getNormal            = mikkNormal;
+    iface.m_getTexCoord          = mikkTexCoord;
+    iface.m_setTSpaceBasic       = mikkSetTSpaceBasic;
+    SMikkTSpaceContext ctx{&iface, &m};
+    if (!genTangSpaceDefault(&ctx)) return;
+
+    // MikkTSpace works per face corner. Give every vertex the frame of its
+    // first corner and split it wherever another corner disagrees.
+    std::vector<char> assigned(n, 0);
+    std::unordered_multimap<uint32_t, uint32_t> copies;  // original -> split copies
+    for (size_t c = 0; c < m.corners.size() / 4; ++c) {
+        const float* t = &m.corners[c * 4];
+        uint32_t v = indices[c];
+        float* dst = &verts[v * l.stride + l.tangent];
+        if (!assigned[v]) {
+            std::memcpy(dst, t, 4 * sizeof(float));
+            assigned[v] = 1;
+            continue;
+        }
+        if (!std::memcmp(dst, t, 4 * sizeof(float))) continue;
+
+        uint32_t use = UINT32_MAX;
+        auto range = copies.equal_range(v);
+        for (auto it = range.first; it != range.second; ++it)
+            if (!std::memcmp(&verts[it->second * l.stride + l.tangent], t, 4 * sizeof(float))) {
+                use = it->second;
+                break;
+            }
+        if (use == UINT32_MAX) {
+            use = (uint32_t)(verts.size() / l.stride);
+            verts.insert(verts.end(), verts.begin() + v * l.stride,
+                         verts.begin() + (v + 1) * l.stride);
+            std::memcpy(&verts[use * l.stride + l.tangent], t, 4 * sizeof(float));
+            copies.emplace(v, use);
+        }
+        indices[c] = use;
+    }
+}
+
+bool tangentsAreReference() { return true; }
+
+#else
+
+void generateTangents(std::vector<float>& verts, const VertexLayout& l,
+                      std::vector<uint32_t>& indices) {
+    const size_t n = verts.size() / l.stride;
+    std::vector<glm::vec3> tan(n, glm::vec3(0.0f)), bit(n, glm::vec3(0.0f));
+
+    for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+        uint32_t a = indices[t], b = indices[t + 1], c = indices[t + 2];
+        if (a >= n || b >= n || c >= n) continue;
+        glm::vec3 pa = vec3At(verts, a, l, l.position);
+        glm::vec3 e1 = vec3At(verts, b, l, l.position) - pa;
+        glm::vec3 e2 = vec3At(verts, c, l, l.position) - pa;
+        glm::vec2 ua = uvAt(verts, a, l);
+        glm::vec2 d1 = uvAt(verts, b, l) - ua;
+        glm::vec2 d2 = uvAt(verts, c, l) - ua;
+        float det = d1.x * d2.y - d2.x * d1.y;
+        if (std::fabs(det) < 1e-20f) continue;
+        float r = 1.0f / det;
+        glm::vec3 sdir = (e1 * d2.y - e2 * d1.y) * r;
+        glm::vec3 tdir = (e2 * d1.x - e1 * d2.x) * r;
+        for (uint32_t v : {a, b, c}) {
+            tan[v] += sdir;
+            bit[v] += tdir;
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        glm::vec3 nrm = vec3At(verts, i, l, l.normal);
+        // Gram-Schmidt against the normal
+        glm::vec3 t = tan[i] - nrm * glm::dot(nrm, tan[i]);
+        float len = glm::length(t);
+        if (len < 1e-20f) {
+            // No usable UV gradient: any vector perpendicular to the normal
+            glm::vec3 axis = std::fabs(nrm.x) < 0.9f ? glm::vec3(1, 0, 0) : glm::vec3(0, 1, 0);
+            t = glm::cross(axis, nrm);
+            len = glm::length(t);
+        }
+        t = len > 1e-20f ? t / len : glm::vec3(1, 0, 0);
+        float w = glm::dot(glm::cross(nrm, t), bit[i]) < 0.0f ? -1.0f : 1.0f;
+        float* p = &verts[i * l.stride + l.tangent];
+        p[0] = t.x; p[1] = t.y; p[2] = t.z; p[3] = w;
+    }
+}
+
+bool tangentsAreReference() { return false; }
+
+#endif
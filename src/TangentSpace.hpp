@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Where each attribute sits inside an interleaved float vertex
+struct VertexLayout {
+    size_t stride;      // floats per vertex
+    size_t position;    // 3 floats
+    size_t normal;      // 3 floats
+    size_t uv;          // 2 floats
+    size_t tangent;     // 4 floats: xyz + handedness
+};
+
+// Smooth normals from area-weighted face normals. Vertices at the same
+// position (UV seams) share one normal so the seam does not show.
+void generateSmoothNormals(std::vector<float>& verts, const VertexLayout& layout,
+                           const std::vector<uint32_t>& indices);
+
+// Tangents for normal mapping, in the glTF convention
+// (bitangent = cross(normal, tangent.xyz) * tangent.w).
+//
+// This is the reference MikkTSpace algorithm (third_party/mikktspace),
+// bit-identical to what Blender and Unity bake against; a vertex whose
+// corners end up with different frames is split, so `verts` and `indices`
+// may grow. Builds configured with FREETUBER_APPROX_TANGENTS accumulate
+// per-vertex tangents from the triangles' UV gradients instead (close, but
+// not identical).
+void generateTangents(std::vector<float>& verts, const VertexLayout& layout,
+                      std::vector<uint32_t>& indices);
+
+// True when generateTangents() uses the reference implementation
+bool tangentsAreReference();
@@ -0,0 +1,82 @@
+#include "TextureCache.hpp"
+#include <map>
+#include <tuple>
+
+#ifndef GL_TEXTURE_MAX_ANISOTROPY
+#define GL_TEXTURE_MAX_ANISOTROPY 0x84FE
+#endif
+
+TextureCache& TextureCache::shared() {
+    static TextureCache cache;
+    return cache;
+}
+
+bool TextureCache::contains(uint64_t key) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return byKey.count(key) != 0;
+}
+
+GLuint TextureCache::acquire(uint64_t key) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = byKey.find(key);
+    if (it == byKey.end()) return 0;
+    ++byTexture[it->second].refs;
+    return it->second;
+}
+
+GLuint TextureCache::insert(uint64_t key, GLuint tex) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = byKey.find(key);
+    if (it != byKey.end()) {
+        glDeleteTextures(1, &tex);
+        ++byTexture[it->second].refs;
+        return it->second;
+    }
+    byKey[key] = tex;
+    byTexture[tex] = Entry{key, 1};
+    return tex;
+}
+
+void TextureCache::release(GLuint tex) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = byTexture.find(tex);
+    if (it == byTexture.end()) {
+        // Not created through the cache
+        glDeleteTextures(1, &tex);
+        return;
+    }
+    if (--it->second.refs > 0) return;
+    byKey.erase(it->second.key);
+    byTexture.erase(it);
+    glDeleteTextures(1, &tex);
+}
+
+static GLint glWrap(int wrap) {
+    switch (wrap) {
+        case 33071: return GL_CLAMP_TO_EDGE;
+        case 33648: return GL_MIRRORED_REPEAT;
+        default:    return GL_REPEAT;
+    }
+}
+
+GLuint samplerFor(const SamplerDesc& desc, const TextureCaps& caps) {
+    static std::map<std::tuple<int, int, int, int>, GLuint> samplers;
+    auto key = std::make_tuple(desc.minFilter, desc.magFilter, desc.wrapS, desc.wrapT);
+    auto it = samplers.find(key);
+    if (it != samplers.end()) return it->second;
+
+    // glTF filter values are the GL enums themselves
+    GLint minFilter = desc.minFilter > 0 ? desc.minFilter : GL_LINEAR_MIPMAP_LINEAR;
+    GLint magFilter = desc.magFilter > 0 ? desc.magFilter : GL_LINEAR;
+    GLuint s;
+    glGenSamplers(1, &s);
+    glSamplerParameteri(s, GL_TEXTURE_MIN_FILTER, minFilter);
+    glSamplerParameteri(s, GL_TEXTURE_MAG_FILTER, magFilter);
+    glSamplerParameteri(s, GL_TEXTURE_WRAP_S, glWrap(desc.wrapS));
+    glSamplerParameteri(s, GL_TEXTURE_WRAP_T, glWrap(desc.wrapT));
+    bool mipmapped = minFilter != GL_NEAREST && minFilter != GL_LINEAR;
+    if (mipmapped && caps.maxAnisotropy > 1.0f)
+        glSamplerParameterf(s, GL_TEXTURE_MAX_ANISOTROPY, caps.maxAnisotropy);
+    samplers.emplace(key, s);
+    return s;
+}
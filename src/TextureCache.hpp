@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <glad/glad.h>
+#include "TextureCompression.hpp"
+
+// Process-wide registry of GL textures keyed by a hash of their source
+// image, so byte-identical images, within one model or across avatars, are
+// decoded and uploaded once. Entries are refcounted. Lookups may come from
+// any thread; textures are created and deleted on the GL thread.
+class TextureCache {
+public:
+    static TextureCache& shared();
+
+    bool contains(uint64_t key) const;
+
+    // The texture for `key` with a new reference taken, or 0
+    GLuint acquire(uint64_t key);
+
+    // Registers a texture the caller just created and holds the first
+    // reference to. If `key` is already present, `tex` is deleted and the
+    // existing texture is returned (with a reference) instead. GL thread.
+    GLuint insert(uint64_t key, GLuint tex);
+
+    // Drops one reference; the last one deletes the texture. GL thread.
+    void release(GLuint tex);
+
+private:
+    struct Entry {
+        uint64_t key;
+        int      refs;
+    };
+    mutable std::mutex                   mtx;
+    std::unordered_map<uint64_t, GLuint> byKey;
+    std::unordered_map<GLuint, Entry>    byTexture;
+};
+
+// glTF sampler state (TINYGLTF_TEXTURE_* values; -1 = unspecified)
+struct SamplerDesc {
+    int minFilter = -1, magFilter = -1;
+    int wrapS = 10497, wrapT = 10497;   // REPEAT
+};
+
+// Shared GL sampler object for `desc`, created on first use and kept for
+// the lifetime of the process. Unspecified filters default to trilinear;
+// mipmapped minification gets the context's maximum anisotropy. GL thread.
+GLuint samplerFor(const SamplerDesc& desc, const TextureCaps& caps);
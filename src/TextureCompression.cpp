@@ -0,0 +1,468 @@
+#include "TextureCompression.hpp"
+#include "Cache.hpp"
+#include "ThreadPool.hpp"
+#include "Log.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT  0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+#endif
+#ifndef GL_MAX_TEXTURE_MAX_ANISOTROPY
+#define GL_MAX_TEXTURE_MAX_ANISOTROPY    0x84FF
+#endif
+#ifndef GL_COMPRESSED_RGBA_BPTC_UNORM
+#define GL_COMPRESSED_RGBA_BPTC_UNORM    0x8E8C
+#endif
+
+// Bump when the encoders change so stale cache entries miss
+static constexpr uint32_t kEncoderVersion = 2;
+static constexpr uint32_t kTextureMagic   = 0x46545458; // 'FTTX'
+
+TextureCaps queryTextureCaps() {
+    TextureCaps caps;
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; ++i) {
+        auto ext = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (!ext) continue;
+        if (!std::strcmp(ext, "GL_EXT_texture_compression_s3tc")) caps.s3tc = true;
+        if (!std::strcmp(ext, "GL_ARB_texture_compression_bptc")) caps.bptc = true;
+        if (!std::strcmp(ext, "GL_EXT_texture_filter_anisotropic") ||
+            !std::strcmp(ext, "GL_ARB_texture_filter_anisotropic"))
+            glGetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, &caps.maxAnisotropy);
+    }
+    return caps;
+}
+
+TextureFormat chooseTextureFormat(const TextureCaps& caps, bool hasAlpha) {
+    if (caps.bptc) return TextureFormat::BC7;
+    if (caps.s3tc) return hasAlpha ? TextureFormat::BC3 : TextureFormat::BC1;
+    return TextureFormat::RGBA8;
+}
+
+static size_t blockBytes(TextureFormat f) {
+    return f == TextureFormat::BC1 ? 8 : 16;
+}
+
+size_t EncodedTexture::bytes() const {
+    size_t n = 0;
+    for (auto& l : levels) n += l.data.size();
+    return n;
+}
+
+// ---------------------------------------------------------------------------
+// Block encoders. Each takes a 4x4 block of RGBA8 pixels in row order.
+
+// Principal axis of the block's colors (first `channels` components),
+// found by power iteration on the covariance matrix
+static void principalAxis(const uint8_t px[16][4], int channels, float mean[4], float axis[4]) {
+    float lo[4] = {255, 255, 255, 255}, hi[4] = {0, 0, 0, 0};
+    for (int c = 0; c < 4; ++c) mean[c] = axis[c] = 0.0f;
+    for (int i = 0; i < 16; ++i)
+        for (int c = 0; c < channels; ++c) {
+            mean[c] += px[i][c];
+            lo[c] = std::min(lo[c], (float)px[i][c]);
+            hi[c] = std::max(hi[c], (float)px[i][c]);
+        }
+    for (int c = 0; c < channels; ++c) mean[c] /= 16.0f;
+
+    float cov[4][4] = {};
+    for (int i = 0; i < 16; ++i)
+        for (int a = 0; a < channels; ++a)
+            for (int b = 0; b < channels; ++b)
+                cov[a][b] += (px[i][a] - mean[a]) * (px[i][b] - mean[b]);
+
+    for (int c = 0; c < channels; ++c) axis[c] = hi[c] - lo[c];
+    for (int iter = 0; iter < 4; ++iter) {
+        float next[4] = {};
+        for (int a = 0; a < channels; ++a)
+            for (int b = 0; b < channels; ++b) next[a] += cov[a][b] * axis[b];
+        float len = 0.0f;
+        for (int c = 0; c < channels; ++c) len = std::max(len, std::fabs(next[c]));
+        if (len < 1e-6f) break;
+        for (int c = 0; c < channels; ++c) axis[c] = next[c] / len;
+    }
+}
+
+// Endpoints: the block's extremes along its principal axis
+static void axisEndpoints(const uint8_t px[16][4], int channels, float e0[4], float e1[4]) {
+    float mean[4], axis[4];
+    principalAxis(px, channels, mean, axis);
+    float tMin = 1e30f, tMax = -1e30f;
+    for (int i = 0; i < 16; ++i) {
+        float t = 0.0f;
+        for (int c = 0; c < channels; ++c) t += (px[i][c] - mean[c]) * axis[c];
+        tMin = std::min(tMin, t);
+        tMax = std::max(tMax, t);
+    }
+    float len2 = 0.0f;
+    for (int c = 0; c < channels; ++c) len2 += axis[c] * axis[c];
+    if (len2 < 1e-12f) len2 = 1.0f;
+    for (int c = 0; c < channels; ++c) {
+        e0[c] = std::clamp(mean[c] + axis[c] * tMax / len2, 0.0f, 255.0f);
+        e1[c] = std::clamp(mean[c] + axis[c] * tMin / len2, 0.0f, 255.0f);
+    }
+}
+
+static int nearest(const uint8_t p[4], const int palette[][4], int count, int channels) {
+    int best = 0, bestErr = INT32_MAX;
+    for (int k = 0; k < count; ++k) {
+        int err = 0;
+        for (int c = 0; c < channels; ++c) {
+            int d = p[c] - palette[k][c];
+            err += d * d;
+        }
+        if (err < bestErr) { bestErr = err; best = k; }
+    }
+    return best;
+}
+
+static uint16_t pack565(const float c[3]) {
+    int r = (int)std::lround(c[0] * 31.0f / 255.0f);
+    int g = (int)std::lround(c[1] * 63.0f / 255.0f);
+    int b = (int)std::lround(c[2] * 31.0f / 255.0f);
+    return (uint16_t)(r << 11 | g << 5 | b);
+}
+
+static void unpack565(uint16_t v, int out[4]) {
+    int r = v >> 11, g = (v >> 5) & 63, b = v & 31;
+    out[0] = r << 3 | r >> 2;
+    out[1] = g << 2 | g >> 4;
+    out[2] = b << 3 | b >> 2;
+    out[3] = 255;
+}
+
+// Four-color BC1 block (also the color half of BC3)
+static void encodeColorBlock(const uint8_t px[16][4], uint8_t* out) {
+    float e0[4], e1[4];
+    axisEndpoints(px, 3, e0, e1);
+    uint16_t c0 = pack565(e0), c1 = pack565(e1);
+    if (c0 < c1) std::swap(c0, c1);
+
+    uint32_t bits = 0;
+    if (c0 != c1) {
+        int pal[4][4];
+        unpack565(c0, pal[0]);
+        unpack565(c1, pal[1]);
+        for (int c = 0; c < 3; ++c) {
+            pal[2][c] = (2 * pal[0][c] + pal[1][c]) / 3;
+            pal[3][c] = (pal[0][c] + 2 * pal[1][c]) / 3;
+        }
+        for (int i = 0; i < 16; ++i)
+            bits |= (uint32_t)nearest(px[i], pal, 4, 3) << (2 * i);
+    }
+    out[0] = c0 & 0xff; out[1] = c0 >> 8;
+    out[2] = c1 & 0xff; out[3] = c1 >> 8;
+    std::memcpy(out + 4, &bits, 4);   // little-endian hosts only, like the rest of the loader
+}
+
+// Eight-value BC3 alpha block
+static void encodeAlphaBlock(const uint8_t px[16][4], uint8_t* out) {
+    int a0 = 0, a1 = 255;
+    for (int i = 0; i < 16; ++i) {
+        a0 = std::max(a0, (int)px[i][3]);
+        a1 = std::min(a1, (int)px[i][3]);
+    }
+    uint64_t bits = 0;
+    if (a0 != a1) {
+        int pal[8][4] = {};
+        pal[0][3] = a0;
+        pal[1][3] = a1;
+        for (int k = 2; k < 8; ++k) pal[k][3] = ((8 - k) * a0 + (k - 1) * a1) / 7;
+        for (int i = 0; i < 16; ++i) {
+            int best = 0, bestErr = INT32_MAX;
+            for (int k = 0; k < 8; ++k) {
+                int d = std::abs(px[i][3] - pal[k][3]);
+                if (d < bestErr) { bestErr = d; best = k; }
+            }
+            bits |= (uint64_t)best << (3 * i);
+        }
+    }
+    out[0] = (uint8_t)a0;
+    out[1] = (uint8_t)a1;
+    for (int b = 0; b < 6; ++b) out[2 + b] = (uint8_t)(bits >> (8 * b));
+}
+
+// BC7 mode 6: one subset, 7.7.7.7 endpoints with a p-bit each, 4-bit indices
+namespace {
+struct BitWriter {
+    uint64_t word[2] = {0, 0};
+    int      pos = 0;
+    void put(uint32_t value, int bits) {
+        for (int b = 0; b < bits; ++b, ++pos)
+            word[pos >> 6] |= (uint64_t)((value >> b) & 1) << (pos & 63);
+    }
+};
+}
+
+// Quantizes an 8-bit endpoint to 7 bits plus a shared p-bit, picking the
+// p-bit that reconstructs it best
+static void quantizeEndpoint7(const float e[4], int q[4], int& pbit) {
+    int bestErr = INT32_MAX;
+    for (int p = 0; p < 2; ++p) {
+        int cand[4], err = 0;
+        for (int c = 0; c < 4; ++c) {
+            cand[c] = std::clamp((int)std::lround((e[c] - p) / 2.0f), 0, 127);
+            int d = (cand[c] << 1 | p) - (int)std::lround(e[c]);
+            err += d * d;
+        }
+        if (err < bestErr) {
+            bestErr = err;
+            pbit = p;
+            std::memcpy(q, cand, sizeof(cand));
+        }
+    }
+}
+
+static void encodeBC7Block(const uint8_t px[16][4], uint8_t* out) {
+    static const int kWeights[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+    float e0[4], e1[4];
+    axisEndpoints(px, 4, e0, e1);
+    int q[2][4], p[2];
+    quantizeEndpoint7(e0, q[0], p[0]);
+    quantizeEndpoint7(e1, q[1], p[1]);
+
+    int pal[16][4];
+    for (int k = 0; k < 16; ++k)
+        for (int c = 0; c < 4; ++c) {
+            int a = q[0][c] << 1 | p[0], b = q[1][c] << 1 | p[1];
+            pal[k][c] = ((64 - kWeights[k]) * a + kWeights[k] * b + 32) >> 6;
+        }
+    int idx[16];
+    for (int i = 0; i < 16; ++i) idx[i] = nearest(px[i], pal, 16, 4);
+
+    // The anchor index is stored with its top bit implied zero
+    if (idx[0] & 8) {
+        std::swap(q[0], q[1]);
+        std::swap(p[0], p[1]);
+        for (int& i : idx) i = 15 - i;
+    }
+
+    BitWriter w;
+    w.put(1 << 6, 7);
+    for (int c = 0; c < 4; ++c) {
+        w.put(q[0][c], 7);
+        w.put(q[1][c], 7);
+    }
+    w.put(p[0], 1);
+    w.put(p[1], 1);
+    w.put(idx[0], 3);
+    for (int i = 1; i < 16; ++i) w.put(idx[i], 4);
+    std::memcpy(out, w.word, 16);
+}
+
+// ---------------------------------------------------------------------------
+
+static void encodeLevel(const TextureLevel& src, TextureFormat format, TextureLevel& dst) {
+    const int bw = (src.width + 3) / 4, bh = (src.height + 3) / 4;
+    const size_t bb = blockBytes(format);
+    dst.width  = src.width;
+    dst.height = src.height;
+    dst.data.resize((size_t)bw * bh * bb);
+
+    ThreadPool::loaders().parallelFor((size_t)bh, [&](size_t by) {
+        uint8_t px[16][4];
+        for (int bx = 0; bx < bw; ++bx) {
+            // Edge blocks of small or odd-sized levels repeat the last texel
+            for (int y = 0; y < 4; ++y)
+                for (int x = 0; x < 4; ++x) {
+                    int sx = std::min(bx * 4 + x, src.width - 1);
+                    int sy = std::min((int)by * 4 + y, src.height - 1);
+                    std::memcpy(px[y * 4 + x], &src.data[((size_t)sy * src.width + sx) * 4], 4);
+                }
+            uint8_t* out = &dst.data[((size_t)by * bw + bx) * bb];
+            switch (format) {
+                case TextureFormat::BC1: encodeColorBlock(px, out); break;
+                case TextureFormat::BC3: encodeAlphaBlock(px, out); encodeColorBlock(px, out + 8); break;
+                case TextureFormat::BC7: encodeBC7Block(px, out); break;
+                case TextureFormat::RGBA8: break;
+            }
+        }
+    });
+}
+
+// 2x2 box filter; an odd last row/column is folded into the last output
+// row/column, which then averages 3 (or 3x3) texels
+static void downsample(const TextureLevel& src, TextureLevel& dst) {
+    dst.width  = std::max(1, src.width / 2);
+    dst.height = std::max(1, src.height / 2);
+    dst.data.resize((size_t)dst.width * dst.height * 4);
+    for (int y = 0; y < dst.height; ++y) {
+        int y0 = std::min(y * 2, src.height - 1);
+        int y1 = y == dst.height - 1 ? src.height - 1 : y * 2 + 1;
+        for (int x = 0; x < dst.width; ++x) {
+            int x0 = std::min(x * 2, src.width - 1);
+            int x1 = x == dst.width - 1 ? src.width - 1 : x * 2 + 1;
+            unsigned sum[4] = {0, 0, 0, 0};
+            unsigned n = 0;
+            for (int sy = y0; sy <= y1; ++sy) {
+                for (int sx = x0; sx <= x1; ++sx, ++n) {
+                    const unsigned char* s = &src.data[((size_t)sy * src.width + sx) * 4];
+                    for (int c = 0; c < 4; ++c) sum[c] += s[c];
+                }
+            }
+            unsigned char* d = &dst.data[((size_t)y * dst.width + x) * 4];
+            for (int c = 0; c < 4; ++c) d[c] = (unsigned char)((sum[c] + n / 2) / n);
+        }
+    }
+}
+
+void encodeTexture(const unsigned char* rgba, int width, int height,
+                   TextureFormat format, EncodedTexture& out) {
+    out.format = format;
+    out.levels.clear();
+
+    TextureLevel level;
+    level.width  = width;
+    level.height = height;
+    level.data.assign(rgba, rgba + (size_t)width * height * 4);
+    for (;;) {
+        TextureLevel next;
+        bool last = level.width == 1 && level.height == 1;
+        if (!last) downsample(level, next);
+        if (format == TextureFormat::RGBA8) {
+            out.levels.push_back(std::move(level));
+        } else {
+            out.levels.emplace_back();
+            encodeLevel(level, format, out.levels.back());
+        }
+        if (last) break;
+        level = std::move(next);
+    }
+}
+
+// Cache entry: magic, version, format, level count, then per level
+// width, height, byte count and the data
+static bool parseTextureCache(const std::vector<unsigned char>& blob, TextureFormat format,
+                              EncodedTexture& out) {
+    size_t at = 0;
+    auto read = [&](void* p, size_t size) {
+        if (blob.size() - at < size) return false;
+        std::memcpy(p, blob.data() + at, size);
+        at += size;
+        return true;
+    };
+    uint32_t head[4];
+    if (!read(head, sizeof(head)) || head[0] != kTextureMagic || head[1] != kEncoderVersion ||
+        head[2] != (uint32_t)format || head[3] == 0 || head[3] > 32)
+        return false;
+    out.format = format;
+    out.levels.resize(head[3]);
+    for (auto& l : out.levels) {
+        uint32_t dims[3];
+        if (!read(dims, sizeof(dims))) return false;
+        l.width  = (int)dims[0];
+        l.height = (int)dims[1];
+        l.data.resize(dims[2]);
+        if (!read(l.data.data(), l.data.size())) return false;
+    }
+    return at == blob.size();
+}
+
+void loadOrEncodeTexture(const unsigned char* rgba, int width, int height,
+                         uint64_t contentHash, const TextureCaps& caps,
+                         EncodedTexture& out) {
+    const size_t pixels = (size_t)width * height;
+    bool hasAlpha = false;
+    for (size_t i = 0; i < pixels && !hasAlpha; ++i) hasAlpha = rgba[i * 4 + 3] != 255;
+    const TextureFormat format = chooseTextureFormat(caps, hasAlpha);
+    if (format == TextureFormat::RGBA8) {
+        // Mips are cheap to rebuild; not worth a cache entry
+        encodeTexture(rgba, width, height, format, out);
+        return;
+    }
+
+    uint32_t key[4] = {kEncoderVersion, (uint32_t)format, (uint32_t)width, (uint32_t)height};
+    const std::string name = cacheName("texture",
+        hashBytes(key, sizeof(key), hashBytes(&contentHash, sizeof(contentHash))));
+    std::vector<unsigned char> blob;
+    if (cacheRead(name, blob) && parseTextureCache(blob, format, out)) return;
+
+    encodeTexture(rgba, width, height, format, out);
+
+    blob.clear();
+    uint32_t head[4] = {kTextureMagic, kEncoderVersion, (uint32_t)format, (uint32_t)out.levels.size()};
+    blob.insert(blob.end(), (unsigned char*)head, (unsigned char*)(head + 4));
+    for (auto& l : out.levels) {
+        uint32_t dims[3] = {(uint32_t)l.width, (uint32_t)l.height, (uint32_t)l.data.size()};
+        blob.insert(blob.end(), (unsigned char*)dims, (unsigned char*)(dims + 3));
+        blob.insert(blob.end(), l.data.begin(), l.data.end());
+    }
+    cacheWrite(name, blob.data(), blob.size());
+}
+
+static GLenum internalFormat(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::BC1:   return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case TextureFormat::BC3:   return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case TextureFormat::BC7:   return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case TextureFormat::RGBA8: break;
+    }
+    return GL_RGBA8;
+}
+
+static void setMipParameters(GLenum target, size_t levels) {
+    glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, (GLint)levels - 1);
+    glTexParameteri(target, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+}
+
+GLuint uploadTexture(const EncodedTexture& tex) {
+    const GLenum internal = internalFormat(tex.format);
+    GLuint id;
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_2D, id);
+    for (size_t i = 0; i < tex.levels.size(); ++i) {
+        const TextureLevel& l = tex.levels[i];
+        if (tex.format == TextureFormat::RGBA8) {
+            glTexImage2D(GL_TEXTURE_2D, (GLint)i, internal, l.width, l.height, 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, l.data.data());
+        } else {
+            glCompressedTexImage2D(GL_TEXTURE_2D, (GLint)i, internal, l.width, l.height, 0,
+                                   (GLsizei)l.data.size(), l.data.data());
+        }
+    }
+    setMipParameters(GL_TEXTURE_2D, tex.levels.size());
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return id;
+}
+
+GLuint uploadTextureArray(const std::vector<const EncodedTexture*>& layers) {
+    const EncodedTexture& first = *layers[0];
+    const GLenum internal = internalFormat(first.format);
+    const GLsizei count = (GLsizei)layers.size();
+    GLuint id;
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, id);
+    for (size_t i = 0; i < first.levels.size(); ++i) {
+        const TextureLevel& l = first.levels[i];
+        const GLsizei size = (GLsizei)l.data.size();
+        if (first.format == TextureFormat::RGBA8) {
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, (GLint)i, internal, l.width, l.height, count, 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        } else {
+            glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, (GLint)i, internal, l.width, l.height,
+                                   count, 0, size * count, nullptr);
+        }
+        for (GLsizei layer = 0; layer < count; ++layer) {
+            const void* texels = layers[layer]->levels[i].data.data();
+            if (first.format == TextureFormat::RGBA8) {
+                glTexSubImage3D(GL_TEXTURE_2D_ARRAY, (GLint)i, 0, 0, layer, l.width, l.height, 1,
+                                GL_RGBA, GL_UNSIGNED_BYTE, texels);
+            } else {
+                glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, (GLint)i, 0, 0, layer,
+                                          l.width, l.height, 1, internal, size, texels);
+            }
+        }
+    }
+    setMipParameters(GL_TEXTURE_2D_ARRAY, first.levels.size());
+    glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+    return id;
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <glad/glad.h>
+
+// Block-compressed textures with a full mip chain, encoded on the CPU the
+// first time an image is seen and cached on disk (see Cache.hpp) after that.
+
+enum class TextureFormat : uint32_t { RGBA8, BC1, BC3, BC7 };
+
+// Compressed formats the current GL context can sample
+struct TextureCaps {
+    bool s3tc = false;   // GL_EXT_texture_compression_s3tc: BC1, BC3
+    bool bptc = false;   // GL_ARB_texture_compression_bptc: BC7
+    float maxAnisotropy = 1.0f;   // 1 without (EXT|ARB)_texture_filter_anisotropic
+};
+
+// Queries the current context (GL thread)
+TextureCaps queryTextureCaps();
+
+// BC7 where available, else BC1 for opaque and BC3 for translucent images,
+// else uncompressed
+TextureFormat chooseTextureFormat(const TextureCaps& caps, bool hasAlpha);
+
+struct TextureLevel {
+    int width = 0, height = 0;
+    std::vector<unsigned char> data;
+};
+
+struct EncodedTexture {
+    TextureFormat format = TextureFormat::RGBA8;
+    std::vector<TextureLevel> levels;   // level 0 first, down to 1x1
+
+    size_t bytes() const;
+};
+
+// Builds the mip chain of an RGBA8 image and encodes every level. Blocks
+// are spread over ThreadPool::loaders().
+void encodeTexture(const unsigned char* rgba, int width, int height,
+                   TextureFormat format, EncodedTexture& out);
+
+// encodeTexture() through the disk cache; `contentHash` identifies the
+// source image (e.g. a hash of its encoded file bytes)
+void loadOrEncodeTexture(const unsigned char* rgba, int width, int height,
+                         uint64_t contentHash, const TextureCaps& caps,
+                         EncodedTexture& out);
+
+// Creates a mipmapped GL texture from `tex` (GL thread)
+GLuint uploadTexture(const EncodedTexture& tex);
+
+// Creates a GL_TEXTURE_2D_ARRAY with one layer per texture; all layers must
+// share format, size and level count (GL thread)
+GLuint uploadTextureArray(const std::vector<const EncodedTexture*>& layers);
@@ -0,0 +1,87 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned workers) {
+    if (workers == 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        workers = hw > 1 ? hw - 1 : 1;
+    }
+    for (unsigned i = 0; i < workers; ++i)
+        threads.emplace_back(&ThreadPool::workerLoop, this);
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stop = true;
+    }
+    wake.notify_all();
+    for (auto& t : threads) t.join();
+}
+
+ThreadPool& ThreadPool::shared() {
+    static ThreadPool pool;
+    return pool;
+}
+
+ThreadPool& ThreadPool::loaders() {
+    static ThreadPool pool;
+    return pool;
+}
+
+void ThreadPool::runItems(const std::function<void(size_t)>& fn, size_t count) {
+    for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < count; )
+        fn(i);
+}
+
+void ThreadPool::workerLoop() {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        wake.wait(lock, [&] { return stop || generation != seen; });
+        if (stop) return;
+        seen = generation;
+        // Taken under the lock: a worker that wakes after the loop is over
+        // finds no job, and the next caller cannot change it while busy > 0
+        const std::function<void(size_t)>* fn = job;
+        size_t count = jobCount;
+        if (!fn) continue;
+        ++busy;
+        lock.unlock();
+        runItems(*fn, count);
+        lock.lock();
+        if (--busy == 0) finished.notify_all();
+    }
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)>& fn) {
+    if (count == 0) return;
+    if (count == 1 || threads.empty()) {
+        for (size_t i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    // One loop at a time. Waiting for another caller's loop would stall a
+    // frame behind a loader (or deadlock a nested call), so run this one on
+    // the calling thread instead.
+    std::unique_lock<std::mutex> serial(submit, std::try_to_lock);
+    if (!serial.owns_lock()) {
+        for (size_t i = 0; i < count; ++i) fn(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        job      = &fn;
+        jobCount = count;
+        next.store(0, std::memory_order_relaxed);
+        ++generation;
+    }
+    wake.notify_all();
+
+    runItems(fn, count);
+
+    std::unique_lock<std::mutex> lock(mtx);
+    finished.wait(lock, [&] { return busy == 0 && next.load() >= jobCount; });
+    job = nullptr;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Small persistent worker pool for fork/join loops on the hot path, where
+// spawning threads (std::async) every frame would cost more than the work.
+class ThreadPool {
+public:
+    // 0 = one worker per hardware thread, minus the caller
+    explicit ThreadPool(unsigned workers = 0);
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    unsigned size() const { return (unsigned)threads.size(); }
+
+    // Calls fn(i) for every i in [0, count), spread over the workers and the
+    // calling thread. Returns when all calls have finished. One loop runs at
+    // a time: a caller that finds the pool busy with another loop (including
+    // a parallelFor from inside one of its own jobs) runs its loop inline
+    // rather than waiting.
+    void parallelFor(size_t count, const std::function<void(size_t)>& fn);
+
+    // Per-frame work on the render thread (spring bones)
+    static ThreadPool& shared();
+    // Load-time loops (geometry decode, normals/tangents, texture encode and
+    // transcode), kept apart so a hot swap never holds up a frame
+    static ThreadPool& loaders();
+
+private:
+    void workerLoop();
+    void runItems(const std::function<void(size_t)>& fn, size_t count);
+
+    std::vector<std::thread>          threads;
+    std::mutex                        submit;   // held by the running loop's caller
+    std::mutex                        mtx;
+    std::condition_variable           wake, finished;
+    const std::function<void(size_t)>* job = nullptr;
+    size_t                            jobCount = 0;
+    std::atomic<size_t>               next{0};
+    unsigned                          busy = 0;
+    uint64_t                          generation = 0;
+    bool                              stop = false;
+};
@@ -1,42 +1,448 @@
 #include "VRMLoader.hpp"
+#include "Log.hpp"
+#include "GltfAccessor.hpp"
+#include "TangentSpace.hpp"
+#include "ThreadPool.hpp"
+#include "Cache.hpp"
+#include "GeometryCompression.hpp"
+#include "Ktx2.hpp"
+#include "TextureCache.hpp"
+#include "GL45.hpp"
 #include <tiny_gltf.h>
 #include <glad/glad.h>
 #include <glm/glm.hpp>
-#include <iostream>
+#include <stb_image.h>
 #include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <cstring>
-#include <algorithm>   // ← added for std::find
-
-// Globals
-std::vector<Mesh>    meshes;
-std::vector<float>   meshYMin;
-std::vector<float>   meshYMax;
-glm::vec3            headPivot(0.0f);
-
-// Helper to read a node’s translation
-static glm::vec3 getNodeTranslation(const tinygltf::Node& n) {
-    if (n.translation.size() == 3) {
-        return {
-            (float)n.translation[0],
-            (float)n.translation[1],
-            (float)n.translation[2]
-        };
+#include <future>
+#include <map>
+#include <tuple>
+#include <mutex>
+#include <unordered_map>
+#include <algorithm>
+
+// glTF extension JSON helpers
+static const tinygltf::Value* findExtension(const tinygltf::Model& model, const char* name) {
+    auto it = model.extensions.find(name);
+    return it != model.extensions.end() && it->second.IsObject() ? &it->second : nullptr;
+}
+
+static const tinygltf::Value* member(const tinygltf::Value& obj, const char* key) {
+    return obj.IsObject() && obj.Has(key) ? &obj.Get(key) : nullptr;
+}
+
+static float numberOr(const tinygltf::Value& obj, const char* key, float def) {
+    auto v = member(obj, key);
+    return v && v->IsNumber() ? (float)v->GetNumberAsDouble() : def;
+}
+
+static int intOr(const tinygltf::Value& obj, const char* key, int def) {
+    auto v = member(obj, key);
+    return v && v->IsNumber() ? v->GetNumberAsInt() : def;
+}
+
+// VRM 0.x writes vectors as {x,y,z}, VRM 1.0 as [x,y,z]
+static glm::vec3 vec3Or(const tinygltf::Value& obj, const char* key, glm::vec3 def) {
+    auto v = member(obj, key);
+    if (!v) return def;
+    if (v->IsArray() && v->ArrayLen() == 3)
+        return {(float)v->Get(0).GetNumberAsDouble(),
+                (float)v->Get(1).GetNumberAsDouble(),
+                (float)v->Get(2).GetNumberAsDouble()};
+    if (v->IsObject())
+        return {numberOr(*v, "x", def.x), numberOr(*v, "y", def.y), numberOr(*v, "z", def.z)};
+    return def;
+}
+
+static std::vector<int> intArray(const tinygltf::Value& obj, const char* key) {
+    std::vector<int> out;
+    auto v = member(obj, key);
+    if (v && v->IsArray())
+        for (size_t i = 0; i < v->ArrayLen(); ++i)
+            if (v->Get((int)i).IsNumber()) out.push_back(v->Get((int)i).GetNumberAsInt());
+    return out;
+}
+
+static int findHeadNode(const tinygltf::Model& model) {
+    // VRM 1.0: humanoid.humanBones.head.node
+    if (auto vrm = findExtension(model, "VRMC_vrm")) {
+        if (auto hum = member(*vrm, "humanoid"))
+            if (auto bones = member(*hum, "humanBones"))
+                if (auto head = member(*bones, "head"))
+                    return intOr(*head, "node", -1);
     }
-    if (n.matrix.size() == 16) {
-        return {
-            (float)n.matrix[12],
-            (float)n.matrix[13],
-            (float)n.matrix[14]
-        };
+    // VRM 0.x: humanoid.humanBones[] = {bone, node}
+    if (auto vrm = findExtension(model, "VRM")) {
+        if (auto hum = member(*vrm, "humanoid"))
+            if (auto bones = member(*hum, "humanBones"); bones && bones->IsArray()) {
+                for (size_t i = 0; i < bones->ArrayLen(); ++i) {
+                    const auto& b = bones->Get((int)i);
+                    auto name = member(b, "bone");
+                    if (name && name->IsString() && name->Get<std::string>() == "head")
+                        return intOr(b, "node", -1);
+                }
+            }
+    }
+    for (size_t i = 0; i < model.nodes.size(); ++i)
+        if (model.nodes[i].name == "J_Bip_C_Head") return (int)i;
+    return -1;
+}
+
+// glTF node index -> Skeleton node index
+using NodeMap = std::vector<int>;
+
+static int mapNode(const NodeMap& map, int gltfNode) {
+    return gltfNode >= 0 && gltfNode < (int)map.size() ? map[gltfNode] : -1;
+}
+
+static NodeMap buildSkeleton(const tinygltf::Model& model, Skeleton& skel) {
+    std::vector<SkeletonNode> nodes(model.nodes.size());
+    for (size_t i = 0; i < model.nodes.size(); ++i) {
+        const auto& n = model.nodes[i];
+        SkeletonNode& s = nodes[i];
+        s.name     = n.name;
+        s.children = n.children;
+        if (n.matrix.size() == 16) {
+            glm::mat4 m;
+            for (int k = 0; k < 16; ++k) m[k / 4][k % 4] = (float)n.matrix[k];
+            s.translation = glm::vec3(m[3]);
+            s.scale = {glm::length(glm::vec3(m[0])), glm::length(glm::vec3(m[1])),
+                       glm::length(glm::vec3(m[2]))};
+            s.rotation = glm::quat_cast(glm::mat3(glm::vec3(m[0]) / s.scale.x,
+                                                  glm::vec3(m[1]) / s.scale.y,
+                                                  glm::vec3(m[2]) / s.scale.z));
+        } else {
+            if (n.translation.size() == 3)
+                s.translation = {(float)n.translation[0], (float)n.translation[1],
+                                 (float)n.translation[2]};
+            if (n.rotation.size() == 4)  // glTF stores x,y,z,w
+                s.rotation = glm::quat((float)n.rotation[3], (float)n.rotation[0],
+                                       (float)n.rotation[1], (float)n.rotation[2]);
+            if (n.scale.size() == 3)
+                s.scale = {(float)n.scale[0], (float)n.scale[1], (float)n.scale[2]};
+        }
+    }
+
+    NodeMap map = skel.build(nodes);
+
+    for (const auto& sk : model.skins) {
+        Skin skin;
+        for (int j : sk.joints) skin.joints.push_back(mapNode(map, j));
+        skin.inverseBind.assign(sk.joints.size(), glm::mat4(1.0f));
+        AccessorView ibm;
+        if (makeAccessorView(model, sk.inverseBindMatrices, ibm) &&
+            ibm.components == 16 && ibm.count == skin.joints.size())
+            readAccessorFloats(ibm, &skin.inverseBind[0][0][0], 16, 16);
+        skel.skins.push_back(std::move(skin));
+    }
+
+    skel.headNode = mapNode(map, findHeadNode(model));
+    return map;
+}
+
+// VRM 0.x: extensions.VRM.secondaryAnimation. Every bone listed in a bone
+// group is the root of a tree that springs down to the leaves.
+static void parseSpringBonesVRM0(const tinygltf::Value& sec, const Skeleton& skel,
+                                 const NodeMap& map, SpringBoneDesc& out) {
+    // VRM 0.x stores collider offsets with Z flipped relative to glTF
+    auto flipZ = [](glm::vec3 v) { return glm::vec3(v.x, v.y, -v.z); };
+
+    if (auto groups = member(sec, "colliderGroups"); groups && groups->IsArray()) {
+        for (size_t g = 0; g < groups->ArrayLen(); ++g) {
+            const auto& grp = groups->Get((int)g);
+            int node = mapNode(map, intOr(grp, "node", -1));
+            std::vector<int> indices;
+            if (auto cols = member(grp, "colliders"); cols && cols->IsArray()) {
+                for (size_t c = 0; c < cols->ArrayLen(); ++c) {
+                    SpringColliderDesc col;
+                    col.node   = node;
+                    col.offset = flipZ(vec3Or(cols->Get((int)c), "offset", glm::vec3(0.0f)));
+                    col.radius = numberOr(cols->Get((int)c), "radius", 0.0f);
+                    indices.push_back((int)out.colliders.size());
+                    out.colliders.push_back(col);
+                }
+            }
+            out.colliderGroups.push_back(std::move(indices));
+        }
+    }
+
+    std::vector<bool> used(skel.size(), false);
+    auto bgs = member(sec, "boneGroups");
+    if (!bgs || !bgs->IsArray()) return;
+    for (size_t g = 0; g < bgs->ArrayLen(); ++g) {
+        const auto& bg = bgs->Get((int)g);
+        SpringJointDesc proto;
+        proto.stiffness    = numberOr(bg, "stiffiness", 1.0f);  // sic, per the VRM 0.x schema
+        proto.gravityPower = numberOr(bg, "gravityPower", 0.0f);
+        proto.gravityDir   = flipZ(vec3Or(bg, "gravityDir", glm::vec3(0, -1, 0)));
+        proto.dragForce    = numberOr(bg, "dragForce", 0.4f);
+        proto.hitRadius    = numberOr(bg, "hitRadius", 0.02f);
+        std::vector<int> colliderGroups = intArray(bg, "colliderGroups");
+
+        for (int bone : intArray(bg, "bones")) {
+            int root = mapNode(map, bone);
+            if (root < 0 || used[root]) continue;
+            SpringChainDesc chain;
+            chain.colliderGroups = colliderGroups;
+            // (node, parent joint) depth-first, parents before children
+            std::vector<std::pair<int, int>> stack{{root, -1}};
+            while (!stack.empty()) {
+                auto [node, parent] = stack.back();
+                stack.pop_back();
+                if (used[node]) continue;
+                used[node] = true;
+                SpringJointDesc j = proto;
+                j.node     = node;
+                j.parent   = parent;
+                const auto& children = skel.children[node];
+                j.tailNode = children.empty() ? -1 : children.front();
+                int self = (int)chain.joints.size();
+                chain.joints.push_back(j);
+                for (auto it = children.rbegin(); it != children.rend(); ++it)
+                    stack.push_back({*it, self});
+            }
+            out.chains.push_back(std::move(chain));
+        }
     }
-    return {0.0f, 0.0f, 0.0f};
 }
 
-bool loadVRM(const std::string& path) {
+// VRM 1.0: extensions.VRMC_springBone. Springs list their joints in order;
+// the last joint only marks where the previous bone ends.
+static void parseSpringBonesVRM1(const tinygltf::Value& ext, const NodeMap& map,
+                                 SpringBoneDesc& out) {
+    if (auto cols = member(ext, "colliders"); cols && cols->IsArray()) {
+        for (size_t c = 0; c < cols->ArrayLen(); ++c) {
+            const auto& col = cols->Get((int)c);
+            SpringColliderDesc d;
+            d.node = mapNode(map, intOr(col, "node", -1));
+            if (auto shape = member(col, "shape")) {
+                if (auto sph = member(*shape, "sphere")) {
+                    d.offset = vec3Or(*sph, "offset", glm::vec3(0.0f));
+                    d.radius = numberOr(*sph, "radius", 0.0f);
+                } else if (auto cap = member(*shape, "capsule")) {
+                    d.offset  = vec3Or(*cap, "offset", glm::vec3(0.0f));
+                    d.radius  = numberOr(*cap, "radius", 0.0f);
+                    d.tail    = vec3Or(*cap, "tail", glm::vec3(0.0f));
+                    d.capsule = true;
+                }
+            }
+            out.colliders.push_back(d);
+        }
+    }
+    if (auto groups = member(ext, "colliderGroups"); groups && groups->IsArray()) {
+        for (size_t g = 0; g < groups->ArrayLen(); ++g)
+            out.colliderGroups.push_back(intArray(groups->Get((int)g), "colliders"));
+    }
+
+    auto springs = member(ext, "springs");
+    if (!springs || !springs->IsArray()) return;
+    for (size_t s = 0; s < springs->ArrayLen(); ++s) {
+        const auto& spring = springs->Get((int)s);
+        auto js = member(spring, "joints");
+        if (!js || !js->IsArray() || js->ArrayLen() < 2) continue;
+        SpringChainDesc chain;
+        chain.colliderGroups = intArray(spring, "colliderGroups");
+        for (size_t k = 0; k + 1 < js->ArrayLen(); ++k) {
+            const auto& jv = js->Get((int)k);
+            SpringJointDesc j;
+            j.node         = mapNode(map, intOr(jv, "node", -1));
+            j.parent       = (int)k - 1;
+            j.tailNode     = mapNode(map, intOr(js->Get((int)k + 1), "node", -1));
+            j.stiffness    = numberOr(jv, "stiffness", 1.0f);
+            j.gravityPower = numberOr(jv, "gravityPower", 0.0f);
+            j.gravityDir   = vec3Or(jv, "gravityDir", glm::vec3(0, -1, 0));
+            j.dragForce    = numberOr(jv, "dragForce", 0.5f);
+            j.hitRadius    = numberOr(jv, "hitRadius", 0.0f);
+            chain.joints.push_back(j);
+        }
+        out.chains.push_back(std::move(chain));
+    }
+}
+
+static void parseSpringBones(const tinygltf::Model& model, const Skeleton& skel,
+                             const NodeMap& map, SpringBoneDesc& out) {
+    if (auto ext = findExtension(model, "VRMC_springBone")) {
+        parseSpringBonesVRM1(*ext, map, out);
+    } else if (auto vrm = findExtension(model, "VRM")) {
+        if (auto sec = member(*vrm, "secondaryAnimation"))
+            parseSpringBonesVRM0(*sec, skel, map, out);
+    }
+}
+
+// tinygltf image callback: keep the encoded bytes instead of decoding them
+// inline, so parseVRM() can decode all images in parallel afterwards.
+struct PendingImages {
+    std::vector<std::vector<unsigned char>> encoded;
+};
+
+static bool deferImageDecode(tinygltf::Image*, const int imageIdx,
+                             std::string*, std::string*, int, int,
+                             const unsigned char* bytes, int size, void* user) {
+    auto* pending = static_cast<PendingImages*>(user);
+    if ((size_t)imageIdx >= pending->encoded.size())
+        pending->encoded.resize(imageIdx + 1);
+    pending->encoded[imageIdx].assign(bytes, bytes + size);
+    return true;
+}
+
+static bool decodeImage(const std::vector<unsigned char>& bytes, VRMImageData& img) {
+    int comp = 0;
+    unsigned char* px = bytes.empty() ? nullptr :
+        stbi_load_from_memory(bytes.data(), (int)bytes.size(),
+                              &img.width, &img.height, &comp, 4);
+    if (!px) {
+        img.width = img.height = 0;
+        return false;
+    }
+    img.rgba.assign(px, px + (size_t)img.width * img.height * 4);
+    stbi_image_free(px);
+    return true;
+}
+
+static double msSince(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - t0).count();
+}
+
+bool encodeImage(VRMImageData& img, const TextureCaps& caps, EncodedTexture& out) {
+    if (isKtx2(img.file.data(), img.file.size())) {
+        auto tKtx = std::chrono::steady_clock::now();
+        bool ok = decodeKtx2(img.file.data(), img.file.size(), caps, out);
+        if (ok) {
+            img.width  = out.levels[0].width;
+            img.height = out.levels[0].height;
+            FT_LOG(Debug, "loadVRM: transcoded KTX2 image ({} levels) in {} ms",
+                   out.levels.size(), msSince(tKtx));
+        }
+        std::vector<unsigned char>().swap(img.file);
+        return ok;
+    }
+    // Decode was skipped at parse time
+    if (!img.file.empty() && !decodeImage(img.file, img))
+        FT_LOG(Warn, "loadVRM: failed to decode image");
+    std::vector<unsigned char>().swap(img.file);
+    if (img.rgba.empty()) return false;
+    loadOrEncodeTexture(img.rgba.data(), img.width, img.height, img.contentHash, caps, out);
+    // Only the encoded copy is needed from here on
+    std::vector<unsigned char>().swap(img.rgba);
+    return !out.levels.empty();
+}
+
+// Missing normals and tangents are generated in parallel, one primitive per
+// task, and cached on disk: the MikkTSpace pass dominates load time on
+// large avatars and its output only depends on the vertex data.
+static constexpr uint32_t kFramesMagic   = 0x46545646; // 'FTVF'
+static constexpr uint32_t kFramesVersion = 1;
+
+static const VertexLayout kVertexLayout{VRMPrimitiveData::kStride, 0, 3, 6, 16};
+
+static void appendBytes(std::vector<unsigned char>& blob, const void* p, size_t size) {
+    auto b = static_cast<const unsigned char*>(p);
+    blob.insert(blob.end(), b, b + size);
+}
+
+static bool readBytes(const std::vector<unsigned char>& blob, size_t& at, void* p, size_t size) {
+    if (blob.size() - at < size) return false;
+    std::memcpy(p, blob.data() + at, size);
+    at += size;
+    return true;
+}
+
+static bool readFramesCache(const std::vector<unsigned char>& blob,
+                            std::vector<VRMPrimitiveData>& prims,
+                            const std::vector<uint32_t>& todo) {
+    size_t at = 0;
+    uint32_t head[3];
+    if (!readBytes(blob, at, head, sizeof(head)) || head[0] != kFramesMagic ||
+        head[1] != kFramesVersion || head[2] != todo.size())
+        return false;
+
+    // Decode into copies so a truncated entry leaves the primitives untouched
+    std::vector<std::vector<float>>    verts(todo.size());
+    std::vector<std::vector<uint32_t>> indices(todo.size());
+    for (size_t i = 0; i < todo.size(); ++i) {
+        uint32_t rec[3];  // primitive, vertex count, index count
+        if (!readBytes(blob, at, rec, sizeof(rec)) || rec[0] != todo[i]) return false;
+        const size_t vertCount = rec[1];
+        verts[i].resize(vertCount * VRMPrimitiveData::kStride);
+        indices[i].resize(rec[2]);
+        if (!readBytes(blob, at, verts[i].data(), verts[i].size() * sizeof(float)) ||
+            !readBytes(blob, at, indices[i].data(), indices[i].size() * sizeof(uint32_t)))
+            return false;
+        for (uint32_t x : indices[i]) if (x >= vertCount) return false;
+    }
+    for (size_t i = 0; i < todo.size(); ++i) {
+        prims[todo[i]].verts   = std::move(verts[i]);
+        prims[todo[i]].indices = std::move(indices[i]);
+    }
+    return true;
+}
+
+static void generateVertexFrames(std::vector<VRMPrimitiveData>& prims) {
+    std::vector<uint32_t> todo;
+    for (size_t i = 0; i < prims.size(); ++i)
+        if (prims[i].needsNormals || prims[i].needsTangents) todo.push_back((uint32_t)i);
+    if (todo.empty()) return;
+
+    // The key covers everything the output depends on, including which
+    // tangent generator this build has
+    const char* generator = tangentsAreReference() ? "mikktspace" : "approx";
+    uint64_t key = hashBytes(generator, std::strlen(generator));
+    key = hashBytes(&kFramesVersion, sizeof(kFramesVersion), key);
+    for (uint32_t i : todo) {
+        const auto& p = prims[i];
+        uint32_t flags[3] = {i, p.needsNormals, p.needsTangents};
+        key = hashBytes(flags, sizeof(flags), key);
+        key = hashVector(p.verts, key);
+        key = hashVector(p.indices, key);
+    }
+    const std::string name = cacheName("vertexframes", key);
+
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<unsigned char> blob;
+    if (cacheRead(name, blob) && readFramesCache(blob, prims, todo)) {
+        FT_LOG(Info, "loadVRM: normals/tangents for {} primitives from cache in {} ms",
+               todo.size(), msSince(t0));
+        return;
+    }
+
+    ThreadPool::loaders().parallelFor(todo.size(), [&](size_t t) {
+        auto& p = prims[todo[t]];
+        if (p.needsNormals) generateSmoothNormals(p.verts, kVertexLayout, p.indices);
+        if (p.needsTangents) generateTangents(p.verts, kVertexLayout, p.indices);
+    });
+    FT_LOG(Info, "loadVRM: generated normals/tangents for {} primitives in {} ms ({})",
+           todo.size(), msSince(t0), generator);
+    static std::atomic<bool> warned{false};
+    if (!tangentsAreReference() && !warned.exchange(true))
+        FT_LOG(Warn, "loadVRM: built with FREETUBER_APPROX_TANGENTS, generated tangents are approximate");
+
+    uint32_t head[3] = {kFramesMagic, kFramesVersion, (uint32_t)todo.size()};
+    blob.clear();
+    appendBytes(blob, head, sizeof(head));
+    for (uint32_t i : todo) {
+        const auto& p = prims[i];
+        uint32_t rec[3] = {i, (uint32_t)(p.verts.size() / VRMPrimitiveData::kStride),
+                           (uint32_t)p.indices.size()};
+        appendBytes(blob, rec, sizeof(rec));
+        appendBytes(blob, p.verts.data(), p.verts.size() * sizeof(float));
+        appendBytes(blob, p.indices.data(), p.indices.size() * sizeof(uint32_t));
+    }
+    cacheWrite(name, blob.data(), blob.size());
+}
+
+bool parseVRM(const std::string& path, VRMData& out) {
     tinygltf::Model    model;
     tinygltf::TinyGLTF loader;
+    PendingImages      pending;
     std::string warn, err;
     bool ok = false;
+    auto t0 = std::chrono::steady_clock::now();
+
+    loader.SetImageLoader(deferImageDecode, &pending);
 
     // Load .vrm/.glb first
     auto ext = path.substr(path.find_last_of('.') + 1);
@@ -44,189 +450,586 @@ bool loadVRM(const std::string& path) {
         ok = loader.LoadBinaryFromFile(&model, &err, &warn, path);
     }
     if (!ok) {
+        pending.encoded.clear();
         ok = loader.LoadASCIIFromFile(&model, &err, &warn, path);
     }
-    if (!warn.empty()) std::cerr << "Warn: " << warn << "\n";
-    if (!err.empty())  std::cerr << "Err:  " << err  << "\n";
+    if (!warn.empty()) FT_LOG(Warn,  "loadVRM: {}", warn);
+    if (!err.empty())  FT_LOG(Error, "loadVRM: {}", err);
     if (!ok) return false;
+    out.parse = {t0, std::chrono::steady_clock::now()};
 
-    // Find head node index
-    int headNodeIndex = -1;
-    for (size_t i = 0; i < model.nodes.size(); ++i) {
-        if (model.nodes[i].name == "J_Bip_C_Head") {
-            headNodeIndex = (int)i;
-            break;
-        }
-    }
+    // Compressed geometry is expanded before anything reads an accessor
+    GeometryDecodeStats geometry;
+    out.geometry.begin = std::chrono::steady_clock::now();
+    if (!decompressGeometry(model, geometry)) return false;
+    out.geometry.end = std::chrono::steady_clock::now();
 
-    // Helper to find a node's parent
-    auto findParent = [&](int childIdx) {
-        for (size_t i = 0; i < model.nodes.size(); ++i) {
-            const auto& children = model.nodes[i].children;
-            if (std::find(children.begin(), children.end(), childIdx) != children.end()) {
-                return (int)i;
+    // Decode images on worker threads while the vertex data is built below
+    out.decode.begin = std::chrono::steady_clock::now();
+    std::vector<std::chrono::steady_clock::time_point> decodeEnd(model.images.size(),
+                                                                 out.decode.begin);  // per image
+    pending.encoded.resize(model.images.size());
+    out.images.resize(model.images.size());
+    std::vector<std::future<void>> decodes;
+    std::mutex dedupeMtx;
+    std::unordered_map<uint64_t, size_t> firstImage;   // content hash -> image
+    for (size_t i = 0; i < model.images.size(); ++i) {
+        decodes.push_back(std::async(std::launch::async, [&, i] {
+            const auto& bytes = pending.encoded[i];
+            VRMImageData& img = out.images[i];
+            img.contentHash = hashVector(bytes);
+            if (!bytes.empty()) {
+                std::lock_guard<std::mutex> lock(dedupeMtx);
+                auto first = firstImage.emplace(img.contentHash, i);
+                if (!first.second) {
+                    img.aliasOf = (int)first.first->second;
+                    return;
+                }
             }
-        }
-        return -1;
-    };
+            // Already on the GPU for another avatar, or a KTX2 file whose
+            // transcode target depends on the GPU: the uploader handles it
+            if (TextureCache::shared().contains(img.contentHash) ||
+                isKtx2(bytes.data(), bytes.size())) {
+                img.file = bytes;
+                return;
+            }
+            if (!decodeImage(bytes, img))
+                FT_LOG(Warn, "loadVRM: failed to decode image {} ({})",
+                       i, model.images[i].name);
+            decodeEnd[i] = std::chrono::steady_clock::now();
+        }));
+    }
 
-    // Compute global head-pivot by summing translations up the chain
-    if (headNodeIndex >= 0) {
-        glm::vec3 pivot = getNodeTranslation(model.nodes[headNodeIndex]);
-        int parent = findParent(headNodeIndex);
-        while (parent >= 0) {
-            pivot += getNodeTranslation(model.nodes[parent]);
-            parent = findParent(parent);
+    out.textureImage.resize(model.textures.size());
+    out.textureSampler.resize(model.textures.size());
+    for (size_t i = 0; i < model.textures.size(); ++i) {
+        out.textureImage[i] = model.textures[i].source;
+        // KHR_texture_basisu: prefer the KTX2 image over the PNG/JPEG fallback
+        auto basisu = model.textures[i].extensions.find("KHR_texture_basisu");
+        if (basisu != model.textures[i].extensions.end())
+            out.textureImage[i] = intOr(basisu->second, "source", out.textureImage[i]);
+        int sampler = model.textures[i].sampler;
+        if (sampler >= 0 && (size_t)sampler < model.samplers.size()) {
+            const auto& smp = model.samplers[sampler];
+            out.textureSampler[i] = SamplerDesc{smp.minFilter, smp.magFilter, smp.wrapS, smp.wrapT};
         }
-        headPivot = pivot;
-        std::cerr << "Computed global headPivot: "
-                  << headPivot.x << ", "
-                  << headPivot.y << ", "
-                  << headPivot.z << "\n";
-    } else {
-        std::cerr << "Warning: J_Bip_C_Head node not found, headPivot remains (0,0,0)\n";
     }
 
-    // 2) Upload images → textures
-    std::vector<GLuint> glImages(model.images.size());
-    for (size_t i = 0; i < model.images.size(); ++i) {
-        auto& img = model.images[i];
-        GLuint tex; glGenTextures(1, &tex);
-        glBindTexture(GL_TEXTURE_2D, tex);
-        GLenum fmt = (img.component == 4 ? GL_RGBA : GL_RGB);
-        glTexImage2D(GL_TEXTURE_2D, 0, fmt,
-                     img.width, img.height, 0,
-                     fmt, GL_UNSIGNED_BYTE,
-                     img.image.data());
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glBindTexture(GL_TEXTURE_2D, 0);
-        glImages[i] = tex;
-    }
-    std::vector<GLuint> glTextures(model.textures.size());
-    for (size_t i = 0; i < model.textures.size(); ++i) {
-        glTextures[i] = glImages[ model.textures[i].source ];
+    // Node hierarchy, skins and spring bones
+    NodeMap nodeMap = buildSkeleton(model, out.skeleton);
+    parseSpringBones(model, out.skeleton, nodeMap, out.springBones);
+    if (out.skeleton.headNode >= 0) {
+        glm::vec3 pivot = glm::vec3(out.skeleton.restWorld[out.skeleton.headNode][3]);
+        FT_LOG(Info, "Head bone {} at {}, {}, {}",
+               out.skeleton.names[out.skeleton.headNode], pivot.x, pivot.y, pivot.z);
+    } else {
+        FT_LOG(Warn, "Head bone not found, head tracking disabled");
     }
-    // Fallback white texture
-    GLuint whiteTex; glGenTextures(1, &whiteTex);
-    glBindTexture(GL_TEXTURE_2D, whiteTex);
-    unsigned char w[4] = {255,255,255,255};
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1,1, 0, GL_RGBA, GL_UNSIGNED_BYTE, w);
-    glBindTexture(GL_TEXTURE_2D, 0);
 
-    // 3) Upload each mesh primitive (Y-min/max, VAO/VBO/EBO, texture, name)
+    // 3) Build each mesh primitive: every attribute is converted straight
+    // into its slot of the interleaved vertex, bounds come from the same pass
+    out.build.begin = std::chrono::steady_clock::now();
+    size_t srcBytes = 0;
+    static const float defaultNormal[3] = {0.0f, 1.0f, 0.0f};
+    const size_t S = VRMPrimitiveData::kStride;
     for (size_t nodeIdx = 0; nodeIdx < model.nodes.size(); ++nodeIdx) {
         auto& node = model.nodes[nodeIdx];
-        if (node.mesh < 0) continue;
+        if (node.mesh < 0 || nodeMap[nodeIdx] < 0) continue;
 
         auto& meshDef = model.meshes[node.mesh];
         for (auto& prim : meshDef.primitives) {
-            // POSITION
-            auto& pAcc  = model.accessors[prim.attributes.at("POSITION")];
-            auto& pView = model.bufferViews[pAcc.bufferView];
-            const float* pos = reinterpret_cast<const float*>(
-                &model.buffers[pView.buffer]
-                      .data[pView.byteOffset + pAcc.byteOffset]);
-
-            // NORMAL
-            auto& nAcc  = model.accessors[prim.attributes.at("NORMAL")];
-            auto& nView = model.bufferViews[nAcc.bufferView];
-            const float* nor = reinterpret_cast<const float*>(
-                &model.buffers[nView.buffer]
-                      .data[nView.byteOffset + nAcc.byteOffset]);
-
-            // TEXCOORD_0 (optional)
-            const float* uvPtr = nullptr;
-            size_t uvCount = 0;
-            if (prim.attributes.count("TEXCOORD_0")) {
-                auto& uAcc  = model.accessors[prim.attributes.at("TEXCOORD_0")];
-                auto& uView = model.bufferViews[uAcc.bufferView];
-                uvPtr = reinterpret_cast<const float*>(
-                    &model.buffers[uView.buffer]
-                          .data[uView.byteOffset + uAcc.byteOffset]);
-                uvCount = uAcc.count;
-            }
-
-            // INDICES
-            auto& iAcc  = model.accessors[prim.indices];
-            auto& iView = model.bufferViews[iAcc.bufferView];
-            const uint32_t* idx = reinterpret_cast<const uint32_t*>(
-                &model.buffers[iView.buffer]
-                      .data[iView.byteOffset + iAcc.byteOffset]);
-            size_t idxCount = iAcc.count;
-
-            // Build verts + compute Y-min/max
-            float yMin =  1e6f, yMax = -1e6f;
-            std::vector<float> verts;
-            verts.reserve(pAcc.count * 8);
-            for (size_t i = 0; i < pAcc.count; ++i) {
-                float y = pos[i*3 + 1];
-                yMin = std::min(yMin, y);
-                yMax = std::max(yMax, y);
-
-                // x,y,z
-                verts.push_back(pos[i*3+0]);
-                verts.push_back(pos[i*3+1]);
-                verts.push_back(pos[i*3+2]);
-                // nx,ny,nz
-                verts.push_back(nor[i*3+0]);
-                verts.push_back(nor[i*3+1]);
-                verts.push_back(nor[i*3+2]);
-                // u,v
-                if (uvPtr && i < uvCount) {
-                    verts.push_back(uvPtr[i*2+0]);
-                    verts.push_back(uvPtr[i*2+1]);
-                } else {
-                    verts.push_back(0.0f);
-                    verts.push_back(0.0f);
-                }
+            const std::string& name = !node.name.empty() ? node.name : meshDef.name;
+            if (prim.mode != TINYGLTF_MODE_TRIANGLES && prim.mode != -1) {
+                FT_LOG(Debug, "loadVRM: {}: skipping non-triangle primitive", name);
+                continue;
+            }
+
+            AccessorView pos;
+            auto posIt = prim.attributes.find("POSITION");
+            if (posIt == prim.attributes.end() ||
+                !makeAccessorView(model, posIt->second, pos) || pos.components != 3) {
+                FT_LOG(Warn, "loadVRM: {}: primitive without usable POSITION skipped", name);
+                continue;
+            }
+            const size_t n = pos.count;
+
+            // Optional attributes must match POSITION's count to be used
+            auto attribute = [&](const char* attr, int comps, AccessorView& v) {
+                auto it = prim.attributes.find(attr);
+                return it != prim.attributes.end() && makeAccessorView(model, it->second, v) &&
+                       v.count == n && v.components == comps;
+            };
+
+            VRMPrimitiveData p;
+            p.node = nodeMap[nodeIdx];
+            p.verts.resize(n * S);  // zero-filled: missing UVs/joints/weights stay 0
+            float* v = p.verts.data();
+
+            readAccessorFloats(pos, v, S, 3, &p.bounds);
+            srcBytes += n * pos.stride;
+
+            AccessorView nor, uv, joints, weights;
+            if (attribute("NORMAL", 3, nor)) {
+                readAccessorFloats(nor, v + 3, S, 3);
+                srcBytes += n * nor.stride;
+            } else {
+                fillFloats(v + 3, n, S, 3, defaultNormal);
+                p.needsNormals = true;
+            }
+            bool hasUV = attribute("TEXCOORD_0", 2, uv);
+            if (hasUV) {
+                readAccessorFloats(uv, v + 6, S, 2);
+                srcBytes += n * uv.stride;
+            }
+            if (node.skin >= 0 && attribute("JOINTS_0", 4, joints) &&
+                attribute("WEIGHTS_0", 4, weights)) {
+                readAccessorFloats(joints,  v + 8,  S, 4);
+                readAccessorFloats(weights, v + 12, S, 4);
+                srcBytes += n * (joints.stride + weights.stride);
+                p.skin = node.skin;
+            }
+
+            // u8/u16/u32 indices widen to u32; unindexed primitives get 0..n-1
+            AccessorView idx;
+            if (prim.indices >= 0 && makeAccessorView(model, prim.indices, idx)) {
+                p.indices.resize(idx.count);
+                readAccessorIndices(idx, p.indices.data());
+                srcBytes += idx.count * idx.stride;
+            } else {
+                p.indices.resize(n);
+                for (size_t i = 0; i < n; ++i) p.indices[i] = (uint32_t)i;
             }
-            meshYMin.push_back(yMin);
-            meshYMax.push_back(yMax);
-
-            // Copy indices
-            std::vector<uint32_t> ids(idxCount);
-            std::memcpy(ids.data(), idx, idxCount * sizeof(uint32_t));
-
-            // Upload to GL
-            Mesh out{};
-            glGenVertexArrays(1, &out.vao);
-            glGenBuffers(1,        &out.vbo);
-            glGenBuffers(1,        &out.ebo);
-
-            glBindVertexArray(out.vao);
-            glBindBuffer(GL_ARRAY_BUFFER, out.vbo);
-            glBufferData(GL_ARRAY_BUFFER,
-                         verts.size() * sizeof(float),
-                         verts.data(), GL_STATIC_DRAW);
-
-            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, out.ebo);
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                         ids.size() * sizeof(uint32_t),
-                         ids.data(), GL_STATIC_DRAW);
-
-            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
-            glEnableVertexAttribArray(0);
-            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
-            glEnableVertexAttribArray(1);
-            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
-            glEnableVertexAttribArray(2);
-            glBindVertexArray(0);
 
-            out.count = ids.size();
-            out.diffuseTex = whiteTex;
             if (prim.material >= 0) {
-                auto& mat = model.materials[prim.material].pbrMetallicRoughness;
-                if (mat.baseColorTexture.index >= 0) {
-                    out.diffuseTex = glTextures[mat.baseColorTexture.index];
-                }
+                auto& mat = model.materials[prim.material];
+                p.texture = mat.pbrMetallicRoughness.baseColorTexture.index;
+                // Tangents only matter where a normal map samples them
+                if (hasUV) p.normalTexture = mat.normalTexture.index;
+                p.blend = mat.alphaMode == "BLEND";
+            }
+            AccessorView tan;
+            if (attribute("TANGENT", 4, tan)) {
+                readAccessorFloats(tan, v + 16, S, 4);
+                srcBytes += n * tan.stride;
+            } else {
+                p.needsTangents = p.normalTexture >= 0;
             }
 
             // Tag mesh by node/mesh name
-            out.name = !node.name.empty() ? node.name : meshDef.name;
-            meshes.push_back(out);
+            p.name = name;
+            out.primitives.push_back(std::move(p));
+        }
+    }
+    out.build.end = std::chrono::steady_clock::now();
+    FT_LOG(Debug, "loadVRM: converted {} MB of vertex/index data in {} ms ({} MB/s)",
+           srcBytes / 1e6, out.build.ms(), srcBytes / 1e3 / std::max(out.build.ms(), 1e-3));
+
+    out.frames.begin = std::chrono::steady_clock::now();
+    generateVertexFrames(out.primitives);
+    out.frames.end = std::chrono::steady_clock::now();
+
+    // The last image finished, not when we got round to waiting for it
+    for (auto& d : decodes) d.get();
+    out.decode.end = out.decode.begin;
+    for (auto t : decodeEnd) out.decode.end = std::max(out.decode.end, t);
+    return true;
+}
+
+VRMUploader::VRMUploader(VRMData data) : data(std::move(data)) {
+    static std::atomic<uint64_t> nextModelId{1};
+    model.id = nextModelId.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool VRMUploader::done() const {
+    return texturesResolved && nextPrim == data.primitives.size();
+}
+
+// Images are uploaded by how materials use them: base-color images go into
+// texture arrays (one per format and size) so meshes only switch a layer,
+// everything else (normal maps) becomes a plain 2D texture. Unused images
+// (e.g. the VRM thumbnail) are not uploaded at all.
+enum : uint8_t { kUseBaseColor = 1, kUseOther = 2 };
+
+static uint64_t whiteKey(bool array) {
+    return hashBytes(array ? "white-array" : "white", array ? 11 : 5);
+}
+
+bool VRMUploader::step(size_t byteBudget, bool wait) {
+    size_t sent = 0;
+    if (model.skeleton.size() == 0) {
+        model.skeleton    = std::move(data.skeleton);
+        model.springBones = std::move(data.springBones);
+    }
+
+    // 2) Encode images (mips + block compression, cached on disk) off the
+    // GL thread, then upload them → textures
+    if (!encodeJob.valid()) {
+        caps = queryTextureCaps();
+        encoded.resize(data.images.size());
+        cachedTex.assign(data.images.size(), 0);
+
+        // Usage is tracked on the first of a set of identical images
+        imageUse.assign(data.images.size(), 0);
+        auto markUse = [&](int texture, uint8_t use) {
+            if (texture < 0 || (size_t)texture >= data.textureImage.size()) return;
+            int img = data.textureImage[texture];
+            if (img < 0 || (size_t)img >= data.images.size()) return;
+            if (data.images[img].aliasOf >= 0) img = data.images[img].aliasOf;
+            imageUse[img] |= use;
+        };
+        for (auto& p : data.primitives) {
+            markUse(p.texture, kUseBaseColor);
+            markUse(p.normalTexture, kUseOther);
+        }
+
+        encodeJob = std::async(std::launch::async, [this] {
+            auto t0 = std::chrono::steady_clock::now();
+            size_t before = 0, after = 0, shared = 0;
+            for (size_t i = 0; i < data.images.size(); ++i) {
+                auto& img = data.images[i];
+                if (img.aliasOf >= 0 || !imageUse[i]) {
+                    std::vector<unsigned char>().swap(img.file);
+                    std::vector<unsigned char>().swap(img.rgba);
+                    continue;
+                }
+                // Array layers need the texels even if another model has
+                // the image as a 2D texture
+                if (!(imageUse[i] & kUseBaseColor) &&
+                    (cachedTex[i] = TextureCache::shared().acquire(img.contentHash))) {
+                    ++shared;
+                    std::vector<unsigned char>().swap(img.file);
+                    std::vector<unsigned char>().swap(img.rgba);
+                    continue;
+                }
+                bool ktx = isKtx2(img.file.data(), img.file.size());
+                if (!encodeImage(img, caps, encoded[i])) {
+                    encoded[i] = EncodedTexture();   // falls back to white
+                    continue;
+                }
+                if (!ktx) before += (size_t)img.width * img.height * 4;
+                after += encoded[i].levels[0].data.size();
+            }
+            FT_LOG(Info, "loadVRM: textures ready in {} ms, {} MB -> {} MB (base level), "
+                   "{} shared with loaded models", msSince(t0), before / 1e6, after / 1e6, shared);
+        });
+    }
+    if (wait) encodeJob.wait();
+    else if (encodeJob.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+
+    if (glImages.empty()) {
+        glImages.resize(data.images.size(), 0);
+
+        // Group base-color images by format, size and level count
+        std::map<std::tuple<TextureFormat, int, int, size_t>, size_t> groupOf;
+        imageLayer.assign(data.images.size(), {-1, 0});
+        for (size_t i = 0; i < data.images.size(); ++i) {
+            const auto& tex = encoded[i];
+            if (!(imageUse[i] & kUseBaseColor) || tex.levels.empty()) continue;
+            auto key = std::make_tuple(tex.format, tex.levels[0].width, tex.levels[0].height,
+                                       tex.levels.size());
+            auto it = groupOf.emplace(key, arrayImages.size()).first;
+            if (it->second == arrayImages.size()) arrayImages.emplace_back();
+            imageLayer[i] = {(int)it->second, (int)arrayImages[it->second].size()};
+            arrayImages[it->second].push_back((int)i);
+        }
+        glArrays.assign(arrayImages.size(), 0);
+    }
+
+    // 2a) Plain textures
+    while (nextImage < data.images.size() && (sent == 0 || sent < byteBudget)) {
+        auto& tex = encoded[nextImage];
+        if (cachedTex[nextImage]) {
+            glImages[nextImage] = cachedTex[nextImage];
+            model.textures.push_back(cachedTex[nextImage]);
+        } else if ((imageUse[nextImage] & kUseOther) && !tex.levels.empty()) {
+            GLuint id = TextureCache::shared().insert(data.images[nextImage].contentHash,
+                                                      uploadTexture(tex));
+            glImages[nextImage] = id;
+            model.textures.push_back(id);
+            sent += tex.bytes();
+        }
+        ++nextImage;
+    }
+    if (nextImage < data.images.size()) return false;
+
+    // 2b) Texture arrays, shared between models with the same set of images
+    while (nextArray < arrayImages.size() && (sent == 0 || sent < byteBudget)) {
+        const auto& members = arrayImages[nextArray];
+        uint64_t key = hashBytes("array", 5);
+        for (int i : members)
+            key = hashBytes(&data.images[i].contentHash, sizeof(uint64_t), key);
+
+        GLuint id = TextureCache::shared().acquire(key);
+        if (!id) {
+            std::vector<const EncodedTexture*> layers;
+            for (int i : members) {
+                layers.push_back(&encoded[i]);
+                sent += encoded[i].bytes();
+            }
+            id = TextureCache::shared().insert(key, uploadTextureArray(layers));
         }
+        glArrays[nextArray++] = id;
+        model.textures.push_back(id);
     }
+    if (nextArray < arrayImages.size()) return false;
 
+    if (!texturesResolved) {
+        // The texels are on the GPU now
+        encoded.clear();
+
+        // Duplicates share the texture of the image they alias
+        for (size_t i = 0; i < data.images.size(); ++i) {
+            int src = data.images[i].aliasOf;
+            if (src < 0) continue;
+            imageLayer[i] = imageLayer[src];
+            if (!glImages[src]) continue;
+            glImages[i] = TextureCache::shared().acquire(data.images[i].contentHash);
+            if (glImages[i]) model.textures.push_back(glImages[i]);
+        }
+
+        // Fallback white texture and layer, shared by every model
+        for (bool array : {false, true}) {
+            GLuint& white = array ? whiteArray : whiteTex;
+            white = TextureCache::shared().acquire(whiteKey(array));
+            if (!white) {
+                EncodedTexture pixel;
+                pixel.levels.push_back(TextureLevel{1, 1, {255, 255, 255, 255}});
+                white = TextureCache::shared().insert(whiteKey(array),
+                    array ? uploadTextureArray({&pixel}) : uploadTexture(pixel));
+            }
+            model.textures.push_back(white);
+        }
+
+        glTextures.assign(data.textureImage.size(), whiteTex);
+        for (size_t i = 0; i < data.textureImage.size(); ++i) {
+            int src = data.textureImage[i];
+            if (src >= 0 && (size_t)src < glImages.size() && glImages[src])
+                glTextures[i] = glImages[src];
+        }
+        texturesResolved = true;
+    }
+
+    // 3) Upload each mesh primitive into the shared buffers (+ texture, name)
+    if (!model.vao && !data.primitives.empty()) {
+        size_t vertCount = 0, indexCount = 0;
+        for (auto& p : data.primitives) {
+            vertCount  += p.verts.size() / VRMPrimitiveData::kStride;
+            indexCount += p.indices.size();
+        }
+        // The draw id of a vertex is the index of its primitive
+        std::vector<uint32_t> drawIds;
+        drawIds.reserve(vertCount);
+        for (size_t i = 0; i < data.primitives.size(); ++i)
+            drawIds.insert(drawIds.end(),
+                           data.primitives[i].verts.size() / VRMPrimitiveData::kStride,
+                           (uint32_t)i);
+
+        const size_t vertBytes  = vertCount * VRMPrimitiveData::kStride * sizeof(float);
+        const size_t indexBytes = indexCount * sizeof(uint32_t);
+        const GLsizei stride = VRMPrimitiveData::kStride * sizeof(float);
+        // position, normal, uv, joints, weights, tangent
+        static const GLint kAttribSize[6]   = {3, 3, 2, 4, 4, 4};
+        static const GLint kAttribOffset[6] = {0, 3, 6, 8, 12, 16};
+        if (haveGL45()) {
+            // Immutable storage, set up without touching bind points
+            gl45.createBuffers(1, &model.vbo);
+            gl45.createBuffers(1, &model.ebo);
+            gl45.createBuffers(1, &model.drawIds);
+            gl45.namedBufferStorage(model.vbo, vertBytes, nullptr, GL_DYNAMIC_STORAGE_BIT);
+            gl45.namedBufferStorage(model.ebo, indexBytes, nullptr, GL_DYNAMIC_STORAGE_BIT);
+            gl45.namedBufferStorage(model.drawIds, drawIds.size() * sizeof(uint32_t),
+                                    drawIds.data(), 0);
+            gl45.createVertexArrays(1, &model.vao);
+            gl45.vertexArrayVertexBuffer(model.vao, 0, model.vbo, 0, stride);
+            gl45.vertexArrayVertexBuffer(model.vao, 1, model.drawIds, 0, sizeof(uint32_t));
+            gl45.vertexArrayElementBuffer(model.vao, model.ebo);
+            for (GLuint i = 0; i < 6; ++i) {
+                gl45.vertexArrayAttribFormat(model.vao, i, kAttribSize[i], GL_FLOAT, GL_FALSE,
+                                             kAttribOffset[i] * sizeof(float));
+                gl45.vertexArrayAttribBinding(model.vao, i, 0);
+                gl45.enableVertexArrayAttrib(model.vao, i);
+            }
+            gl45.vertexArrayAttribIFormat(model.vao, 6, 1, GL_UNSIGNED_INT, 0);
+            gl45.vertexArrayAttribBinding(model.vao, 6, 1);
+            gl45.enableVertexArrayAttrib(model.vao, 6);
+        } else {
+            glGenVertexArrays(1, &model.vao);
+            glGenBuffers(1, &model.vbo);
+            glGenBuffers(1, &model.ebo);
+            glGenBuffers(1, &model.drawIds);
+            glBindVertexArray(model.vao);
+
+            glBindBuffer(GL_ARRAY_BUFFER, model.vbo);
+            glBufferData(GL_ARRAY_BUFFER, vertBytes, nullptr, GL_STATIC_DRAW);
+            for (GLuint i = 0; i < 6; ++i) {
+                glVertexAttribPointer(i, kAttribSize[i], GL_FLOAT, GL_FALSE, stride,
+                                      (void*)(kAttribOffset[i] * sizeof(float)));
+                glEnableVertexAttribArray(i);
+            }
+
+            glBindBuffer(GL_ARRAY_BUFFER, model.drawIds);
+            glBufferData(GL_ARRAY_BUFFER, drawIds.size() * sizeof(uint32_t),
+                         drawIds.data(), GL_STATIC_DRAW);
+            glVertexAttribIPointer(6, 1, GL_UNSIGNED_INT, 0, (void*)0);
+            glEnableVertexAttribArray(6);
+
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, model.ebo);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexBytes, nullptr, GL_STATIC_DRAW);
+            glBindVertexArray(0);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+        sent += drawIds.size() * sizeof(uint32_t);
+    }
+    while (nextPrim < data.primitives.size() && (sent == 0 || sent < byteBudget)) {
+        const uint32_t drawId = (uint32_t)nextPrim;
+        auto& p = data.primitives[nextPrim++];
+        Mesh out{};
+        out.firstIndex = (uint32_t)nextIndex;
+        out.baseVertex = (int32_t)nextVertex;
+        out.drawId     = drawId;
+
+        const GLintptr vertOffset  = nextVertex * VRMPrimitiveData::kStride * sizeof(float);
+        const GLintptr indexOffset = nextIndex * sizeof(uint32_t);
+        if (haveGL45()) {
+            gl45.namedBufferSubData(model.vbo, vertOffset, p.verts.size() * sizeof(float),
+                                    p.verts.data());
+            gl45.namedBufferSubData(model.ebo, indexOffset, p.indices.size() * sizeof(uint32_t),
+                                    p.indices.data());
+        } else {
+            glBindBuffer(GL_ARRAY_BUFFER, model.vbo);
+            glBufferSubData(GL_ARRAY_BUFFER, vertOffset, p.verts.size() * sizeof(float),
+                            p.verts.data());
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+            // The element buffer binding is VAO state
+            glBindVertexArray(model.vao);
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, indexOffset,
+                            p.indices.size() * sizeof(uint32_t), p.indices.data());
+            glBindVertexArray(0);
+        }
+        nextVertex += p.verts.size() / VRMPrimitiveData::kStride;
+        nextIndex  += p.indices.size();
+        sent += p.verts.size() * sizeof(float) + p.indices.size() * sizeof(uint32_t);
+
+        out.count = p.indices.size();
+        out.diffuseTex = whiteArray;
+        out.diffuseSampler = samplerFor(SamplerDesc{}, caps);
+        if (p.texture >= 0 && (size_t)p.texture < data.textureImage.size()) {
+            int img = data.textureImage[p.texture];
+            if (img >= 0 && (size_t)img < imageLayer.size() && imageLayer[img].first >= 0) {
+                out.diffuseTex   = glArrays[imageLayer[img].first];
+                out.diffuseLayer = imageLayer[img].second;
+            }
+            out.diffuseSampler = samplerFor(data.textureSampler[p.texture], caps);
+        }
+        // The white fallback is not a valid normal map; leave it unbound
+        if (p.normalTexture >= 0 && (size_t)p.normalTexture < glTextures.size() &&
+            glTextures[p.normalTexture] != whiteTex) {
+            out.normalTex = glTextures[p.normalTexture];
+            out.normalSampler = samplerFor(data.textureSampler[p.normalTexture], caps);
+        }
+        out.blend = p.blend;
+        out.name = p.name;
+        out.node = p.node;
+        out.skin = p.skin;
+        out.bounds = p.bounds;
+        model.meshes.push_back(out);
+    }
+
+    if (done() && !arraysLogged) {
+        // Renderers may regroup opaque and alpha-tested meshes by texture,
+        // but blended ones (hair cards, lashes, face overlays) have to
+        // composite over them in the order the file gives
+        auto blended = std::stable_partition(model.meshes.begin(), model.meshes.end(),
+                                             [](const Mesh& m) { return !m.blend; });
+        size_t layers = 0;
+        for (auto& a : arrayImages) layers += a.size();
+        FT_LOG(Info, "loadVRM: {} base-color textures in {} arrays, {} blended meshes drawn last",
+               layers, arrayImages.size(), model.meshes.end() - blended);
+        arraysLogged = true;
+    }
+    return done();
+}
+
+bool benchmarkKtx2Textures(const std::string& path) {
+    tinygltf::Model    model;
+    tinygltf::TinyGLTF loader;
+    PendingImages      pending;
+    std::string warn, err;
+    loader.SetImageLoader(deferImageDecode, &pending);
+    if (!loader.LoadBinaryFromFile(&model, &err, &warn, path)) {
+        FT_LOG(Error, "KTX2 bench: cannot load {}: {}", path, err);
+        return false;
+    }
+    pending.encoded.resize(model.images.size());
+
+    // Texture pairs: KTX2 source, fallback source
+    std::vector<std::pair<int, int>> pairs;
+    for (const auto& tex : model.textures) {
+        auto basisu = tex.extensions.find("KHR_texture_basisu");
+        if (basisu == tex.extensions.end()) continue;
+        int ktx = intOr(basisu->second, "source", -1);
+        if (ktx < 0 || tex.source < 0 || (size_t)ktx >= model.images.size() ||
+            (size_t)tex.source >= model.images.size())
+            continue;
+        if (isKtx2(pending.encoded[ktx].data(), pending.encoded[ktx].size()))
+            pairs.emplace_back(ktx, tex.source);
+    }
+    if (pairs.empty()) {
+        FT_LOG(Error, "KTX2 bench: {} has no KTX2 textures with a fallback image", path);
+        return false;
+    }
+
+    const int passes = 5;
+    TextureCaps bc7, rgba8;
+    bc7.s3tc = bc7.bptc = true;
+    double bc7Ms = 0, rgba8Ms = 0, fallbackMs = 0;
+    size_t ktxBytes = 0, fallbackBytes = 0;
+    for (int pass = 0; pass < passes; ++pass) {
+        for (const auto& p : pairs) {
+            const auto& ktx = pending.encoded[p.first];
+            EncodedTexture out;
+            auto t0 = std::chrono::steady_clock::now();
+            if (!decodeKtx2(ktx.data(), ktx.size(), bc7, out)) return false;
+            bc7Ms += msSince(t0);
+            t0 = std::chrono::steady_clock::now();
+            if (!decodeKtx2(ktx.data(), ktx.size(), rgba8, out)) return false;
+            rgba8Ms += msSince(t0);
+
+            VRMImageData img;
+            t0 = std::chrono::steady_clock::now();
+            if (!decodeImage(pending.encoded[p.second], img)) return false;
+            fallbackMs += msSince(t0);
+            if (pass == 0) {
+                ktxBytes      += ktx.size();
+                fallbackBytes += pending.encoded[p.second].size();
+            }
+        }
+    }
+    FT_LOG(Info, "KTX2 bench: {} textures, {} KB KTX2 vs {} KB fallback, mean of {} passes",
+           pairs.size(), ktxBytes / 1024, fallbackBytes / 1024, passes);
+    FT_LOG(Info, "  KTX2 to BC7:        {} ms", bc7Ms / passes);
+    FT_LOG(Info, "  KTX2 to RGBA8:      {} ms", rgba8Ms / passes);
+    FT_LOG(Info, "  fallback to RGBA8:  {} ms (BC7 encode not included)", fallbackMs / passes);
+    return true;
+}
+
+void uploadVRM(VRMData data, Model& out) {
+    VRMUploader uploader(std::move(data));
+    while (!uploader.step(SIZE_MAX, true)) {}
+    out = std::move(uploader.result());
+}
+
+void releaseModel(Model& model) {
+    glDeleteVertexArrays(1, &model.vao);
+    GLuint buffers[3] = {model.vbo, model.ebo, model.drawIds};
+    glDeleteBuffers(3, buffers);
+    for (GLuint tex : model.textures) TextureCache::shared().release(tex);
+    model = Model();
+}
+
+bool loadVRM(const std::string& path, Model& out) {
+    VRMData data;
+    if (!parseVRM(path, data)) return false;
+    uploadVRM(std::move(data), out);
     return true;
-}
\ No newline at end of file
+}
@@ -1,27 +1,155 @@
 #pragma once
+#include <chrono>
 #include <string>
 #include <vector>
 #include <glm/glm.hpp>
 #include <glad/glad.h>
+#include "Skeleton.hpp"
+#include "SpringBone.hpp"
+#include "GltfAccessor.hpp"
+#include "TextureCompression.hpp"
+#include "TextureCache.hpp"
+#include <future>
 
 // A single mesh primitive
 struct Mesh {
-    GLuint vao = 0, vbo = 0, ebo = 0;
-    GLuint diffuseTex = 0;
+    // Range in the model's shared vertex/index buffers
+    uint32_t firstIndex = 0;
+    int32_t  baseVertex = 0;
+    uint32_t drawId = 0;     // per-vertex id the shaders use to find this mesh's state
+    GLuint diffuseTex = 0;   // GL_TEXTURE_2D_ARRAY
+    int    diffuseLayer = 0;
+    GLuint normalTex = 0;    // 0 if the material has no normal map
+    GLuint diffuseSampler = 0, normalSampler = 0;   // shared, see samplerFor()
+    bool   blend = false;    // alphaMode BLEND: drawn after the rest, in file order
     size_t count = 0;
     // Node/primitive name from the VRM (e.g. "J_Bip_C_Head", "Hair", "Body")
     std::string name;
+    int node = -1;   // skeleton node the mesh hangs off
+    int skin = -1;   // Skeleton::skins index, or -1 for rigid meshes
+    AABB bounds;     // bind-pose bounds in mesh space
 };
 
-// All loaded meshes
-extern std::vector<Mesh> meshes;
+// One uploaded avatar. Owns every GL object it references; release it with
+// releaseModel() on the GL thread. Scenes share it between avatars through
+// ModelLibrary and never modify it after upload.
+struct Model {
+    uint64_t            id = 0;   // unique per upload; keys per-model renderer state
+    std::vector<Mesh>   meshes;
 
-// Per-mesh Y-bounds (if you still need thresholding)
-extern std::vector<float> meshYMin;
-extern std::vector<float> meshYMax;
+    // Vertices and indices of every mesh in one set of buffers, plus a
+    // per-vertex draw id stream (location 6)
+    GLuint vao = 0, vbo = 0, ebo = 0, drawIds = 0;
 
-// Head pivot in MODEL SPACE (neck joint position)
-extern glm::vec3 headPivot;
+    // One TextureCache reference per entry (including the white fallback)
+    std::vector<GLuint> textures;
 
-// Load a VRM/glb and fill meshes + headPivot
-bool loadVRM(const std::string& path);
+    Skeleton            skeleton;
+    SpringBoneDesc      springBones;
+};
+
+// CPU-side result of parsing a VRM: decoded images and interleaved vertex
+// data, ready for uploadVRM(). Producing it makes no GL calls.
+struct VRMImageData {
+    int width = 0, height = 0;
+    std::vector<unsigned char> rgba;   // always 4 channels
+    uint64_t contentHash = 0;          // of the encoded file bytes
+    // Undecoded file: KTX2 (transcoded at upload), or an image TextureCache
+    // already holds (decoded at upload only if it was evicted meanwhile)
+    std::vector<unsigned char> file;
+    int aliasOf = -1;                  // byte-identical to this earlier image
+};
+
+struct VRMPrimitiveData {
+    // x,y,z, nx,ny,nz, u,v, joints[4], weights[4], tx,ty,tz,tw
+    static constexpr int kStride = 20;
+    std::vector<float>    verts;
+    std::vector<uint32_t> indices;
+    AABB  bounds;
+    int   texture = -1;                // index into VRMData::textureImage
+    int   normalTexture = -1;          // likewise, for the normal map
+    bool  blend = false;               // material alphaMode is BLEND
+    // Attributes the file left out that have to be generated
+    bool  needsNormals = false, needsTangents = false;
+    int   node = -1, skin = -1;
+    std::string name;
+};
+
+// When a parse stage started and finished
+struct ParseStage {
+    std::chrono::steady_clock::time_point begin, end;
+    double ms() const { return std::chrono::duration<double, std::milli>(end - begin).count(); }
+};
+
+struct VRMData {
+    std::vector<VRMImageData>     images;
+    std::vector<int>              textureImage;  // glTF texture -> image
+    std::vector<SamplerDesc>      textureSampler;  // glTF texture -> sampler state
+    std::vector<VRMPrimitiveData> primitives;
+    Skeleton       skeleton;
+    SpringBoneDesc springBones;
+
+    // Parse stages; image decoding overlaps building and normals/tangents
+    ParseStage parse, geometry, decode, build, frames;
+};
+
+// Parse a VRM/glb on any thread; images are decoded in parallel.
+bool parseVRM(const std::string& path, VRMData& out);
+
+// Encoded mip chain of a parsed image for `caps` (any thread): transcodes
+// KTX2, decodes files skipped at parse time, block-compresses through the
+// disk cache. Frees the image's file and pixel data.
+bool encodeImage(VRMImageData& img, const TextureCaps& caps, EncodedTexture& out);
+
+// Times transcoding each KTX2 texture that has a PNG/JPEG fallback, to BC7
+// and to RGBA8, against decoding the fallback, and logs the totals. Runs
+// without a GL context.
+bool benchmarkKtx2Textures(const std::string& path);
+
+// Uploads parsed data on the GL context thread, a slice at a time, so a
+// model can be brought in over several frames without a hitch.
+class VRMUploader {
+public:
+    explicit VRMUploader(VRMData data);
+    // The texture encode job holds on to `this`
+    VRMUploader(const VRMUploader&) = delete;
+    VRMUploader& operator=(const VRMUploader&) = delete;
+
+    // Uploads until roughly `byteBudget` bytes were sent (always at least one
+    // item). Returns true once everything is on the GPU. With `wait`, blocks
+    // until the textures are encoded instead of returning false meanwhile.
+    bool step(size_t byteBudget, bool wait = false);
+    bool done() const;
+
+    // The finished model; only valid once done()
+    Model& result() { return model; }
+
+private:
+    VRMData             data;
+    Model               model;
+    // Mip chains and block compression are built on a worker thread once
+    // the GL context has told us which formats it supports
+    std::vector<EncodedTexture> encoded;
+    std::vector<GLuint> cachedTex;     // references taken from TextureCache
+    TextureCaps         caps;
+    std::future<void>   encodeJob;
+    std::vector<uint8_t> imageUse;     // kUseBaseColor | kUseOther
+    std::vector<GLuint> glImages, glTextures;
+    // Base-color images grouped into texture arrays
+    std::vector<std::vector<int>>   arrayImages;   // array -> images (layer order)
+    std::vector<std::pair<int,int>> imageLayer;    // image -> (array, layer)
+    std::vector<GLuint> glArrays;
+    GLuint              whiteTex = 0, whiteArray = 0;
+    size_t              nextImage = 0, nextArray = 0, nextPrim = 0;
+    size_t              nextVertex = 0, nextIndex = 0;   // fill level of the shared buffers
+    bool                texturesResolved = false, arraysLogged = false;
+};
+
+// Upload parsed data in one go on the GL context thread
+void uploadVRM(VRMData data, Model& out);
+
+// Frees the GL objects owned by a model (GL thread)
+void releaseModel(Model& model);
+
+// Load a VRM/glb into `out` (parseVRM + uploadVRM)
+bool loadVRM(const std::string& path, Model& out);
@@ -0,0 +1,1185 @@
+#include "Renderer.hpp"
+#include "Log.hpp"
+
+#ifndef FT_HAVE_VULKAN
+
+std::unique_ptr<Renderer> createVulkanRenderer(int, int) {
+    FT_LOG(Error, "Renderer: built without Vulkan (needs the Vulkan headers/loader and glslc)");
+    return nullptr;
+}
+
+#else
+
+#include <vulkan/vulkan.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <tuple>
+
+// SPIR-V of shaders/vk/mesh.{vert,frag}, compiled and linked in by CMake
+// (VulkanShaders.S)
+extern "C" {
+extern const char ft_res_mesh_vert_spv[], ft_res_mesh_vert_spv_end[];
+extern const char ft_res_mesh_frag_spv[], ft_res_mesh_frag_spv_end[];
+}
+
+static constexpr int           kFramesInFlight = 2;
+static constexpr size_t        kTexelsPerDraw  = 5;     // mat4 + params, as in DrawList
+static constexpr VkFormat      kColorFormat    = VK_FORMAT_R8G8B8A8_UNORM;
+static constexpr VkDeviceSize  kStagingAlign   = 16;    // covers every BC block size
+
+static bool vkCheck(VkResult r, const char* what) {
+    if (r == VK_SUCCESS) return true;
+    FT_LOG(Error, "Vulkan: {} failed ({})", what, (int)r);
+    return false;
+}
+
+static VkDeviceSize alignUp(VkDeviceSize v, VkDeviceSize a) {
+    return (v + a - 1) / a * a;
+}
+
+namespace {
+
+struct Buffer {
+    VkBuffer       buffer = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    void*          mapped = nullptr;    // host-visible buffers stay mapped
+    VkDeviceSize   size   = 0;
+};
+
+struct Image {
+    VkImage        image  = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VkImageView    view   = VK_NULL_HANDLE;
+};
+
+// One recorded frame; command buffers are recorded once and resubmitted
+// until the model, the target, a buffer binding or the instance count changes
+struct FrameSlot {
+    VkCommandBuffer cmd   = VK_NULL_HANDLE;
+    VkFence         fence = VK_NULL_HANDLE;
+    VkDescriptorSet set   = VK_NULL_HANDLE;
+    Buffer          uniforms, draws, joints;
+    bool            recorded = false;
+    uint32_t        instances = 0;      // instance count baked into cmd
+};
+
+struct GpuMesh {
+    uint32_t firstIndex = 0, count = 0, drawId = 0;
+    int32_t  baseVertex = 0;
+    int      node = -1, skin = -1;
+    size_t   material = 0;
+    bool     normalMapped = false;
+    bool     blend = false;
+};
+
+struct FrameUniforms {
+    glm::mat4 view, proj;
+    glm::vec4 lightDir, ambient;
+    uint32_t  drawsPerInstance, pad[3];
+};
+
+class VulkanRenderer : public Renderer {
+public:
+    ~VulkanRenderer() override;
+    bool init(int width, int height);
+
+    const char* name() const override { return "vulkan"; }
+    bool upload(VRMData data) override;
+    void resize(int width, int height) override;
+    void drawFrame(const FrameState& frame) override;
+    void finish() override;
+    bool readPixels(std::vector<unsigned char>& rgba, int& width, int& height) override;
+
+private:
+    bool createDevice();
+    bool createTargets(int width, int height);
+    void destroyTargets();
+    bool createPipeline();
+    bool createFrames();
+
+    int32_t memoryType(uint32_t typeBits, VkMemoryPropertyFlags props) const;
+    bool createBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props,
+                      Buffer& out);
+    void destroyBuffer(Buffer& b);
+    bool createImage(uint32_t width, uint32_t height, uint32_t levels, VkFormat format,
+                     VkImageUsageFlags usage, VkImageAspectFlags aspect, Image& out);
+    void destroyImage(Image& img);
+    VkSampler samplerFor(const SamplerDesc& desc);
+
+    VkCommandBuffer beginOneShot();
+    bool submitOneShot(VkCommandBuffer cmd);
+
+    void releaseModel();
+    bool ensureCapacity(FrameSlot& slot, VkDeviceSize drawBytes, VkDeviceSize jointBytes);
+    void record(FrameSlot& slot);
+    void invalidateRecordings();
+
+    VkInstance       instance = VK_NULL_HANDLE;
+    VkPhysicalDevice physical = VK_NULL_HANDLE;
+    VkDevice         device   = VK_NULL_HANDLE;
+    VkQueue          queue    = VK_NULL_HANDLE;
+    uint32_t         queueFamily = 0;
+    VkPhysicalDeviceMemoryProperties memProps{};
+    bool             bcTextures = false;
+    float            maxAnisotropy = 1.0f;   // 1 without samplerAnisotropy
+    VkCommandPool    commandPool = VK_NULL_HANDLE;
+
+    // Offscreen target
+    int           width = 0, height = 0;
+    VkFormat      depthFormat = VK_FORMAT_UNDEFINED;
+    Image         color, depth;
+    VkRenderPass  renderPass  = VK_NULL_HANDLE;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    bool          rendered = false;   // color holds a finished frame
+
+    // Pipeline, built once
+    VkDescriptorSetLayout frameLayout = VK_NULL_HANDLE, materialLayout = VK_NULL_HANDLE;
+    VkPipelineLayout      pipelineLayout = VK_NULL_HANDLE;
+    VkPipeline            pipeline = VK_NULL_HANDLE;
+    VkDescriptorPool      framePool = VK_NULL_HANDLE;
+    std::map<std::tuple<int, int, int, int>, VkSampler> samplers;
+
+    FrameSlot frames[kFramesInFlight];
+    int       frameIndex = 0;
+
+    // Current model
+    Buffer                       geometry;   // vertices | draw ids | indices
+    VkDeviceSize                 drawIdOffset = 0, indexOffset = 0;
+    std::vector<Image>           textures;   // [0] is the white fallback
+    VkDescriptorPool             materialPool = VK_NULL_HANDLE;
+    std::vector<VkDescriptorSet> materials;
+    std::vector<GpuMesh>          meshes;     // by material, then blended in file order
+    std::vector<glm::vec4>       drawTable;
+    std::vector<glm::mat4>       jointMats;
+    std::vector<int>             skinOffsets;
+};
+
+} // namespace
+
+std::unique_ptr<Renderer> createVulkanRenderer(int width, int height) {
+    auto r = std::make_unique<VulkanRenderer>();
+    if (!r->init(width, height)) return nullptr;
+    return r;
+}
+
+// ---------------------------------------------------------------------------
+// Setup
+
+bool VulkanRenderer::init(int w, int h) {
+    return createDevice() && createTargets(w, h) && createPipeline() && createFrames();
+}
+
+bool VulkanRenderer::createDevice() {
+    VkApplicationInfo app{};
+    app.sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
+    app.pApplicationName = "FreeTuber";
+    app.apiVersion = VK_API_VERSION_1_0;
+
+    // FREETUBER_VK_VALIDATION=1 turns on the Khronos validation layer
+    std::vector<const char*> layers;
+    if (const char* v = std::getenv("FREETUBER_VK_VALIDATION"); v && *v == '1') {
+        uint32_t n = 0;
+        vkEnumerateInstanceLayerProperties(&n, nullptr);
+        std::vector<VkLayerProperties> props(n);
+        vkEnumerateInstanceLayerProperties(&n, props.data());
+        for (auto& p : props)
+            if (!std::strcmp(p.layerName, "VK_LAYER_KHRONOS_validation"))
+                layers.push_back("VK_LAYER_KHRONOS_validation");
+        if (layers.empty()) FT_LOG(Warn, "Vulkan: validation layer not installed");
+    }
+
+    VkInstanceCreateInfo ici{};
+    ici.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
+    ici.pApplicationInfo = &app;
+    ici.enabledLayerCount = (uint32_t)layers.size();
+    ici.ppEnabledLayerNames = layers.data();
+    if (!vkCheck(vkCreateInstance(&ici, nullptr, &instance), "vkCreateInstance")) return false;
+
+    uint32_t count = 0;
+    vkEnumeratePhysicalDevices(instance, &count, nullptr);
+    std::vector<VkPhysicalDevice> devices(count);
+    vkEnumeratePhysicalDevices(instance, &count, devices.data());
+
+    // Headless: any device with a graphics queue. FREETUBER_VK_DEVICE picks
+    // one by name, otherwise discrete beats integrated beats CPU.
+    const char* wanted = std::getenv("FREETUBER_VK_DEVICE");
+    int bestScore = -1;
+    for (VkPhysicalDevice d : devices) {
+        VkPhysicalDeviceProperties props;
+        vkGetPhysicalDeviceProperties(d, &props);
+        uint32_t nq = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(d, &nq, nullptr);
+        std::vector<VkQueueFamilyProperties> families(nq);
+        vkGetPhysicalDeviceQueueFamilyProperties(d, &nq, families.data());
+        int family = -1;
+        for (uint32_t q = 0; q < nq && family < 0; ++q)
+            if (families[q].queueFlags & VK_QUEUE_GRAPHICS_BIT) family = (int)q;
+        if (family < 0) continue;
+
+        int score = 0;
+        if (wanted && std::strstr(props.deviceName, wanted))        score = 100;
+        else if (props.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU)   score = 3;
+        else if (props.deviceType == VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU) score = 2;
+        else if (props.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU)            score = 1;
+        if (score > bestScore) {
+            bestScore   = score;
+            physical    = d;
+            queueFamily = (uint32_t)family;
+        }
+    }
+    if (!physical) {
+        FT_LOG(Error, "Vulkan: no device with a graphics queue");
+        return false;
+    }
+
+    VkPhysicalDeviceProperties props;
+    vkGetPhysicalDeviceProperties(physical, &props);
+    VkPhysicalDeviceFeatures supported;
+    vkGetPhysicalDeviceFeatures(physical, &supported);
+    vkGetPhysicalDeviceMemoryProperties(physical, &memProps);
+
+    VkPhysicalDeviceFeatures enabled{};
+    enabled.textureCompressionBC = supported.textureCompressionBC;
+    enabled.samplerAnisotropy    = supported.samplerAnisotropy;
+    bcTextures = supported.textureCompressionBC == VK_TRUE;
+    if (supported.samplerAnisotropy)
+        maxAnisotropy = std::min(16.0f, props.limits.maxSamplerAnisotropy);
+
+    float priority = 1.0f;
+    VkDeviceQueueCreateInfo qci{};
+    qci.sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    qci.queueFamilyIndex = queueFamily;
+    qci.queueCount = 1;
+    qci.pQueuePriorities = &priority;
+    VkDeviceCreateInfo dci{};
+    dci.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+    dci.queueCreateInfoCount = 1;
+    dci.pQueueCreateInfos = &qci;
+    dci.pEnabledFeatures = &enabled;
+    if (!vkCheck(vkCreateDevice(physical, &dci, nullptr, &device), "vkCreateDevice")) return false;
+    vkGetDeviceQueue(device, queueFamily, 0, &queue);
+
+    VkCommandPoolCreateInfo pci{};
+    pci.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    pci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pci.queueFamilyIndex = queueFamily;
+    if (!vkCheck(vkCreateCommandPool(device, &pci, nullptr, &commandPool), "vkCreateCommandPool"))
+        return false;
+
+    FT_LOG(Info, "Renderer: Vulkan on {} (BC textures: {}, anisotropy {})",
+           props.deviceName, bcTextures, maxAnisotropy);
+    return true;
+}
+
+bool VulkanRenderer::createTargets(int w, int h) {
+    width  = std::max(1, w);
+    height = std::max(1, h);
+    rendered = false;
+
+    if (depthFormat == VK_FORMAT_UNDEFINED) {
+        for (VkFormat f : {VK_FORMAT_D32_SFLOAT, VK_FORMAT_X8_D24_UNORM_PACK32,
+                           VK_FORMAT_D24_UNORM_S8_UINT}) {
+            VkFormatProperties fp;
+            vkGetPhysicalDeviceFormatProperties(physical, f, &fp);
+            if (fp.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) {
+                depthFormat = f;
+                break;
+            }
+        }
+    }
+    if (!createImage(width, height, 1, kColorFormat,
+                     VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                     VK_IMAGE_ASPECT_COLOR_BIT, color) ||
+        !createImage(width, height, 1, depthFormat, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT,
+                     VK_IMAGE_ASPECT_DEPTH_BIT, depth))
+        return false;
+
+    if (!renderPass) {
+        VkAttachmentDescription att[2]{};
+        att[0].format         = kColorFormat;
+        att[0].samples        = VK_SAMPLE_COUNT_1_BIT;
+        att[0].loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR;
+        att[0].storeOp        = VK_ATTACHMENT_STORE_OP_STORE;
+        att[0].stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        att[0].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        att[0].initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED;
+        att[0].finalLayout    = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;   // ready for readback
+        att[1] = att[0];
+        att[1].format         = depthFormat;
+        att[1].storeOp        = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        att[1].finalLayout    = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+
+        VkAttachmentReference colorRef{0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+        VkAttachmentReference depthRef{1, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+        VkSubpassDescription subpass{};
+        subpass.pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS;
+        subpass.colorAttachmentCount    = 1;
+        subpass.pColorAttachments       = &colorRef;
+        subpass.pDepthStencilAttachment = &depthRef;
+
+        // Frames reuse the same attachments: order this frame's writes after
+        // the previous frame's writes and readback copies
+        VkSubpassDependency deps[2]{};
+        deps[0].srcSubpass    = VK_SUBPASS_EXTERNAL;
+        deps[0].dstSubpass    = 0;
+        deps[0].srcStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT |
+                                VK_PIPELINE_STAGE_TRANSFER_BIT;
+        deps[0].dstStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+                                VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+        deps[0].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                                VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+                                VK_ACCESS_TRANSFER_READ_BIT;
+        deps[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+                                VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+                                VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        deps[1].srcSubpass    = 0;
+        deps[1].dstSubpass    = VK_SUBPASS_EXTERNAL;
+        deps[1].srcStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        deps[1].dstStageMask  = VK_PIPELINE_STAGE_TRANSFER_BIT;
+        deps[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        deps[1].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+        VkRenderPassCreateInfo rpci{};
+        rpci.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+        rpci.attachmentCount = 2;
+        rpci.pAttachments    = att;
+        rpci.subpassCount    = 1;
+        rpci.pSubpasses      = &subpass;
+        rpci.dependencyCount = 2;
+        rpci.pDependencies   = deps;
+        if (!vkCheck(vkCreateRenderPass(device, &rpci, nullptr, &renderPass), "vkCreateRenderPass"))
+            return false;
+    }
+
+    VkImageView views[2] = {color.view, depth.view};
+    VkFramebufferCreateInfo fci{};
+    fci.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    fci.renderPass      = renderPass;
+    fci.attachmentCount = 2;
+    fci.pAttachments    = views;
+    fci.width  = (uint32_t)width;
+    fci.height = (uint32_t)height;
+    fci.layers = 1;
+    return vkCheck(vkCreateFramebuffer(device, &fci, nullptr, &framebuffer), "vkCreateFramebuffer");
+}
+
+void VulkanRenderer::destroyTargets() {
+    vkDestroyFramebuffer(device, framebuffer, nullptr);
+    framebuffer = VK_NULL_HANDLE;
+    destroyImage(color);
+    destroyImage(depth);
+}
+
+static VkShaderModule shaderModule(VkDevice device, const char* begin, const char* end) {
+    // Blobs are 16-byte aligned by the .S file, as SPIR-V needs
+    VkShaderModuleCreateInfo ci{};
+    ci.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+    ci.codeSize = (size_t)(end - begin);
+    ci.pCode    = reinterpret_cast<const uint32_t*>(begin);
+    VkShaderModule m = VK_NULL_HANDLE;
+    vkCheck(vkCreateShaderModule(device, &ci, nullptr, &m), "vkCreateShaderModule");
+    return m;
+}
+
+bool VulkanRenderer::createPipeline() {
+    // set 0: per frame (uniforms, draw table, joints); set 1: per material
+    VkDescriptorSetLayoutBinding frameBindings[3]{};
+    frameBindings[0] = {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1,
+                        VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT, nullptr};
+    frameBindings[1] = {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr};
+    frameBindings[2] = {2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT, nullptr};
+    VkDescriptorSetLayoutBinding materialBindings[2]{};
+    materialBindings[0] = {0, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1,
+                           VK_SHADER_STAGE_FRAGMENT_BIT, nullptr};
+    materialBindings[1] = {1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1,
+                           VK_SHADER_STAGE_FRAGMENT_BIT, nullptr};
+
+    VkDescriptorSetLayoutCreateInfo lci{};
+    lci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    lci.bindingCount = 3;
+    lci.pBindings    = frameBindings;
+    if (!vkCheck(vkCreateDescriptorSetLayout(device, &lci, nullptr, &frameLayout),
+                 "vkCreateDescriptorSetLayout"))
+        return false;
+    lci.bindingCount = 2;
+    lci.pBindings    = materialBindings;
+    if (!vkCheck(vkCreateDescriptorSetLayout(device, &lci, nullptr, &materialLayout),
+                 "vkCreateDescriptorSetLayout"))
+        return false;
+
+    VkDescriptorSetLayout setLayouts[2] = {frameLayout, materialLayout};
+    VkPipelineLayoutCreateInfo plci{};
+    plci.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    plci.setLayoutCount = 2;
+    plci.pSetLayouts    = setLayouts;
+    if (!vkCheck(vkCreatePipelineLayout(device, &plci, nullptr, &pipelineLayout),
+                 "vkCreatePipelineLayout"))
+        return false;
+
+    VkShaderModule vert = shaderModule(device, ft_res_mesh_vert_spv, ft_res_mesh_vert_spv_end);
+    VkShaderModule frag = shaderModule(device, ft_res_mesh_frag_spv, ft_res_mesh_frag_spv_end);
+    if (!vert || !frag) {
+        vkDestroyShaderModule(device, vert, nullptr);
+        vkDestroyShaderModule(device, frag, nullptr);
+        return false;
+    }
+    VkPipelineShaderStageCreateInfo stages[2]{};
+    stages[0] = {VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, nullptr, 0,
+                 VK_SHADER_STAGE_VERTEX_BIT, vert, "main", nullptr};
+    stages[1] = {VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, nullptr, 0,
+                 VK_SHADER_STAGE_FRAGMENT_BIT, frag, "main", nullptr};
+
+    // Same interleaved layout as the GL VAO: binding 0 vertices, binding 1 draw ids
+    const uint32_t stride = VRMPrimitiveData::kStride * sizeof(float);
+    VkVertexInputBindingDescription bindings[2] = {
+        {0, stride, VK_VERTEX_INPUT_RATE_VERTEX},
+        {1, sizeof(uint32_t), VK_VERTEX_INPUT_RATE_VERTEX},
+    };
+    VkVertexInputAttributeDescription attribs[7] = {
+        {0, 0, VK_FORMAT_R32G32B32_SFLOAT,    0},
+        {1, 0, VK_FORMAT_R32G32B32_SFLOAT,    3 * sizeof(float)},
+        {2, 0, VK_FORMAT_R32G32_SFLOAT,       6 * sizeof(float)},
+        {3, 0, VK_FORMAT_R32G32B32A32_SFLOAT, 8 * sizeof(float)},
+        {4, 0, VK_FORMAT_R32G32B32A32_SFLOAT, 12 * sizeof(float)},
+        {5, 0, VK_FORMAT_R32G32B32A32_SFLOAT, 16 * sizeof(float)},
+        {6, 1, VK_FORMAT_R32_UINT,            0},
+    };
+    VkPipelineVertexInputStateCreateInfo vertexInput{};
+    vertexInput.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertexInput.vertexBindingDescriptionCount   = 2;
+    vertexInput.pVertexBindingDescriptions      = bindings;
+    vertexInput.vertexAttributeDescriptionCount = 7;
+    vertexInput.pVertexAttributeDescriptions    = attribs;
+
+    VkPipelineInputAssemblyStateCreateInfo assembly{};
+    assembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    VkPipelineViewportStateCreateInfo viewport{};
+    viewport.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport.viewportCount = 1;
+    viewport.scissorCount  = 1;
+
+    VkPipelineRasterizationStateCreateInfo raster{};
+    raster.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    raster.polygonMode = VK_POLYGON_MODE_FILL;
+    raster.cullMode    = VK_CULL_MODE_NONE;
+    raster.frontFace   = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    raster.lineWidth   = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo multisample{};
+    multisample.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    VkPipelineDepthStencilStateCreateInfo depthState{};
+    depthState.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depthState.depthTestEnable  = VK_TRUE;
+    depthState.depthWriteEnable = VK_TRUE;
+    depthState.depthCompareOp   = VK_COMPARE_OP_LESS;
+
+    // Alpha blending, as in the GL backend
+    VkPipelineColorBlendAttachmentState blend{};
+    blend.blendEnable         = VK_TRUE;
+    blend.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+    blend.dstColorBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    blend.colorBlendOp        = VK_BLEND_OP_ADD;
+    blend.srcAlphaBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
+    blend.dstAlphaBlendFactor = VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+    blend.alphaBlendOp        = VK_BLEND_OP_ADD;
+    blend.colorWriteMask      = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+                                VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+    VkPipelineColorBlendStateCreateInfo blendState{};
+    blendState.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    blendState.attachmentCount = 1;
+    blendState.pAttachments    = &blend;
+
+    // Viewport and scissor are dynamic so resizing keeps the pipeline
+    VkDynamicState dynamic[2] = {VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR};
+    VkPipelineDynamicStateCreateInfo dynamicState{};
+    dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamicState.dynamicStateCount = 2;
+    dynamicState.pDynamicStates    = dynamic;
+
+    VkGraphicsPipelineCreateInfo gpci{};
+    gpci.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    gpci.stageCount          = 2;
+    gpci.pStages             = stages;
+    gpci.pVertexInputState   = &vertexInput;
+    gpci.pInputAssemblyState = &assembly;
+    gpci.pViewportState      = &viewport;
+    gpci.pRasterizationState = &raster;
+    gpci.pMultisampleState   = &multisample;
+    gpci.pDepthStencilState  = &depthState;
+    gpci.pColorBlendState    = &blendState;
+    gpci.pDynamicState       = &dynamicState;
+    gpci.layout              = pipelineLayout;
+    gpci.renderPass          = renderPass;
+    gpci.subpass             = 0;
+    bool ok = vkCheck(vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &gpci, nullptr, &pipeline),
+                      "vkCreateGraphicsPipelines");
+    vkDestroyShaderModule(device, vert, nullptr);
+    vkDestroyShaderModule(device, frag, nullptr);
+    return ok;
+}
+
+bool VulkanRenderer::createFrames() {
+    VkDescriptorPoolSize sizes[2] = {
+        {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, kFramesInFlight},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 2 * kFramesInFlight},
+    };
+    VkDescriptorPoolCreateInfo dpci{};
+    dpci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    dpci.maxSets       = kFramesInFlight;
+    dpci.poolSizeCount = 2;
+    dpci.pPoolSizes    = sizes;
+    if (!vkCheck(vkCreateDescriptorPool(device, &dpci, nullptr, &framePool), "vkCreateDescriptorPool"))
+        return false;
+
+    VkCommandBuffer cmds[kFramesInFlight];
+    VkCommandBufferAllocateInfo cai{};
+    cai.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cai.commandPool        = commandPool;
+    cai.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cai.commandBufferCount = kFramesInFlight;
+    if (!vkCheck(vkAllocateCommandBuffers(device, &cai, cmds), "vkAllocateCommandBuffers"))
+        return false;
+
+    for (int i = 0; i < kFramesInFlight; ++i) {
+        FrameSlot& f = frames[i];
+        f.cmd = cmds[i];
+        VkFenceCreateInfo fci{};
+        fci.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        fci.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+        if (!vkCheck(vkCreateFence(device, &fci, nullptr, &f.fence), "vkCreateFence")) return false;
+
+        VkDescriptorSetAllocateInfo dsai{};
+        dsai.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        dsai.descriptorPool     = framePool;
+        dsai.descriptorSetCount = 1;
+        dsai.pSetLayouts        = &frameLayout;
+        if (!vkCheck(vkAllocateDescriptorSets(device, &dsai, &f.set), "vkAllocateDescriptorSets"))
+            return false;
+        // Storage buffers grow with the model; start with one draw and one joint
+        if (!createBuffer(sizeof(FrameUniforms), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                          VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                          f.uniforms) ||
+            !ensureCapacity(f, kTexelsPerDraw * sizeof(glm::vec4), sizeof(glm::mat4)))
+            return false;
+    }
+    return true;
+}
+
+VulkanRenderer::~VulkanRenderer() {
+    if (!device) {
+        if (instance) vkDestroyInstance(instance, nullptr);
+        return;
+    }
+    vkDeviceWaitIdle(device);
+    releaseModel();
+    for (FrameSlot& f : frames) {
+        vkDestroyFence(device, f.fence, nullptr);
+        destroyBuffer(f.uniforms);
+        destroyBuffer(f.draws);
+        destroyBuffer(f.joints);
+    }
+    for (auto& s : samplers) vkDestroySampler(device, s.second, nullptr);
+    vkDestroyDescriptorPool(device, framePool, nullptr);
+    vkDestroyPipeline(device, pipeline, nullptr);
+    vkDestroyPipelineLayout(device, pipelineLayout, nullptr);
+    vkDestroyDescriptorSetLayout(device, frameLayout, nullptr);
+    vkDestroyDescriptorSetLayout(device, materialLayout, nullptr);
+    destroyTargets();
+    vkDestroyRenderPass(device, renderPass, nullptr);
+    vkDestroyCommandPool(device, commandPool, nullptr);
+    vkDestroyDevice(device, nullptr);
+    vkDestroyInstance(instance, nullptr);
+}
+
+// ---------------------------------------------------------------------------
+// Resources
+
+int32_t VulkanRenderer::memoryType(uint32_t typeBits, VkMemoryPropertyFlags props) const {
+    for (uint32_t i = 0; i < memProps.memoryTypeCount; ++i)
+        if ((typeBits & (1u << i)) && (memProps.memoryTypes[i].propertyFlags & props) == props)
+            return (int32_t)i;
+    return -1;
+}
+
+bool VulkanRenderer::createBuffer(VkDeviceSize size, VkBufferUsageFlags usage,
+                                  VkMemoryPropertyFlags props, Buffer& out) {
+    VkBufferCreateInfo bci{};
+    bci.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bci.size        = std::max<VkDeviceSize>(size, 4);
+    bci.usage       = usage;
+    bci.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if (!vkCheck(vkCreateBuffer(device, &bci, nullptr, &out.buffer), "vkCreateBuffer")) return false;
+
+    VkMemoryRequirements req;
+    vkGetBufferMemoryRequirements(device, out.buffer, &req);
+    VkMemoryAllocateInfo mai{};
+    mai.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    mai.allocationSize = req.size;
+    int32_t type = memoryType(req.memoryTypeBits, props);
+    if (type < 0) {
+        FT_LOG(Error, "Vulkan: no memory type for a {} byte buffer", (uint64_t)size);
+        return false;
+    }
+    mai.memoryTypeIndex = (uint32_t)type;
+    if (!vkCheck(vkAllocateMemory(device, &mai, nullptr, &out.memory), "vkAllocateMemory") ||
+        !vkCheck(vkBindBufferMemory(device, out.buffer, out.memory, 0), "vkBindBufferMemory"))
+        return false;
+    if ((props & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) &&
+        !vkCheck(vkMapMemory(device, out.memory, 0, VK_WHOLE_SIZE, 0, &out.mapped), "vkMapMemory"))
+        return false;
+    out.size = size;
+    return true;
+}
+
+void VulkanRenderer::destroyBuffer(Buffer& b) {
+    // Freeing the memory unmaps it
+    vkDestroyBuffer(device, b.buffer, nullptr);
+    vkFreeMemory(device, b.memory, nullptr);
+    b = Buffer();
+}
+
+bool VulkanRenderer::createImage(uint32_t w, uint32_t h, uint32_t levels, VkFormat format,
+                                 VkImageUsageFlags usage, VkImageAspectFlags aspect, Image& out) {
+    VkImageCreateInfo ici{};
+    ici.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    ici.imageType     = VK_IMAGE_TYPE_2D;
+    ici.format        = format;
+    ici.extent        = {w, h, 1};
+    ici.mipLevels     = levels;
+    ici.arrayLayers   = 1;
+    ici.samples       = VK_SAMPLE_COUNT_1_BIT;
+    ici.tiling        = VK_IMAGE_TILING_OPTIMAL;
+    ici.usage         = usage;
+    ici.sharingMode   = VK_SHARING_MODE_EXCLUSIVE;
+    ici.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    if (!vkCheck(vkCreateImage(device, &ici, nullptr, &out.image), "vkCreateImage")) return false;
+
+    VkMemoryRequirements req;
+    vkGetImageMemoryRequirements(device, out.image, &req);
+    int32_t type = memoryType(req.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    if (type < 0) type = memoryType(req.memoryTypeBits, 0);
+    VkMemoryAllocateInfo mai{};
+    mai.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    mai.allocationSize  = req.size;
+    mai.memoryTypeIndex = (uint32_t)type;
+    if (type < 0 ||
+        !vkCheck(vkAllocateMemory(device, &mai, nullptr, &out.memory), "vkAllocateMemory") ||
+        !vkCheck(vkBindImageMemory(device, out.image, out.memory, 0), "vkBindImageMemory"))
+        return false;
+
+    VkImageViewCreateInfo vci{};
+    vci.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    vci.image            = out.image;
+    vci.viewType         = VK_IMAGE_VIEW_TYPE_2D;
+    vci.format           = format;
+    vci.subresourceRange = {aspect, 0, levels, 0, 1};
+    return vkCheck(vkCreateImageView(device, &vci, nullptr, &out.view), "vkCreateImageView");
+}
+
+void VulkanRenderer::destroyImage(Image& img) {
+    vkDestroyImageView(device, img.view, nullptr);
+    vkDestroyImage(device, img.image, nullptr);
+    vkFreeMemory(device, img.memory, nullptr);
+    img = Image();
+}
+
+// glTF sampler enums (GL values) to Vulkan; unspecified filters are trilinear
+VkSampler VulkanRenderer::samplerFor(const SamplerDesc& desc) {
+    auto key = std::make_tuple(desc.minFilter, desc.magFilter, desc.wrapS, desc.wrapT);
+    auto it = samplers.find(key);
+    if (it != samplers.end()) return it->second;
+
+    auto wrap = [](int w) {
+        switch (w) {
+            case 33071: return VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+            case 33648: return VK_SAMPLER_ADDRESS_MODE_MIRRORED_REPEAT;
+            default:    return VK_SAMPLER_ADDRESS_MODE_REPEAT;
+        }
+    };
+    const int minF = desc.minFilter < 0 ? 9987 : desc.minFilter;   // LINEAR_MIPMAP_LINEAR
+    const bool mipmapped = minF >= 9984 && minF <= 9987;
+    VkSamplerCreateInfo sci{};
+    sci.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+    sci.magFilter    = desc.magFilter == 9728 ? VK_FILTER_NEAREST : VK_FILTER_LINEAR;
+    sci.minFilter    = (minF == 9728 || minF == 9984 || minF == 9986) ? VK_FILTER_NEAREST
+                                                                        : VK_FILTER_LINEAR;
+    sci.mipmapMode   = (minF == 9986 || minF == 9987) ? VK_SAMPLER_MIPMAP_MODE_LINEAR
+                                                      : VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    sci.addressModeU = wrap(desc.wrapS);
+    sci.addressModeV = wrap(desc.wrapT);
+    sci.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT;
+    sci.anisotropyEnable = mipmapped && maxAnisotropy > 1.0f;
+    sci.maxAnisotropy    = maxAnisotropy;
+    sci.minLod = 0.0f;
+    sci.maxLod = mipmapped ? VK_LOD_CLAMP_NONE : 0.0f;   // GL samples level 0 without mips
+
+    VkSampler s = VK_NULL_HANDLE;
+    vkCheck(vkCreateSampler(device, &sci, nullptr, &s), "vkCreateSampler");
+    samplers.emplace(key, s);
+    return s;
+}
+
+VkCommandBuffer VulkanRenderer::beginOneShot() {
+    VkCommandBufferAllocateInfo cai{};
+    cai.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    cai.commandPool        = commandPool;
+    cai.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    cai.commandBufferCount = 1;
+    VkCommandBuffer cmd = VK_NULL_HANDLE;
+    if (!vkCheck(vkAllocateCommandBuffers(device, &cai, &cmd), "vkAllocateCommandBuffers"))
+        return VK_NULL_HANDLE;
+    VkCommandBufferBeginInfo bi{};
+    bi.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(cmd, &bi);
+    return cmd;
+}
+
+bool VulkanRenderer::submitOneShot(VkCommandBuffer cmd) {
+    vkEndCommandBuffer(cmd);
+    VkSubmitInfo si{};
+    si.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    si.commandBufferCount = 1;
+    si.pCommandBuffers    = &cmd;
+    bool ok = vkCheck(vkQueueSubmit(queue, 1, &si, VK_NULL_HANDLE), "vkQueueSubmit") &&
+              vkCheck(vkQueueWaitIdle(queue), "vkQueueWaitIdle");
+    vkFreeCommandBuffers(device, commandPool, 1, &cmd);
+    return ok;
+}
+
+// ---------------------------------------------------------------------------
+// Model upload: everything goes through one staging buffer and one submit
+
+static VkFormat toVkFormat(TextureFormat f) {
+    switch (f) {
+        case TextureFormat::BC1:   return VK_FORMAT_BC1_RGB_UNORM_BLOCK;
+        case TextureFormat::BC3:   return VK_FORMAT_BC3_UNORM_BLOCK;
+        case TextureFormat::BC7:   return VK_FORMAT_BC7_UNORM_BLOCK;
+        case TextureFormat::RGBA8: break;
+    }
+    return VK_FORMAT_R8G8B8A8_UNORM;
+}
+
+static void imageBarrier(VkCommandBuffer cmd, VkImage image, uint32_t levels,
+                         VkImageLayout from, VkImageLayout to,
+                         VkAccessFlags srcAccess, VkAccessFlags dstAccess,
+                         VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage) {
+    VkImageMemoryBarrier b{};
+    b.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+    b.srcAccessMask       = srcAccess;
+    b.dstAccessMask       = dstAccess;
+    b.oldLayout           = from;
+    b.newLayout           = to;
+    b.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    b.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    b.image               = image;
+    b.subresourceRange    = {VK_IMAGE_ASPECT_COLOR_BIT, 0, levels, 0, 1};
+    vkCmdPipelineBarrier(cmd, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &b);
+}
+
+void VulkanRenderer::releaseModel() {
+    for (Image& t : textures) destroyImage(t);
+    textures.clear();
+    destroyBuffer(geometry);
+    vkDestroyDescriptorPool(device, materialPool, nullptr);
+    materialPool = VK_NULL_HANDLE;
+    materials.clear();
+    meshes.clear();
+}
+
+bool VulkanRenderer::upload(VRMData data) {
+    vkDeviceWaitIdle(device);
+    releaseModel();
+    invalidateRecordings();
+
+    // Encoded mip chains of the images materials use; [0] is the white fallback
+    TextureCaps caps;
+    caps.s3tc = caps.bptc = bcTextures;
+    std::vector<EncodedTexture> encoded(1);
+    encoded[0].levels.push_back({1, 1, {255, 255, 255, 255}});
+    std::vector<int> imageTexture(data.images.size(), -1);
+    auto textureOf = [&](int texture) {
+        if (texture < 0 || (size_t)texture >= data.textureImage.size()) return 0;
+        int img = data.textureImage[texture];
+        if (img < 0 || (size_t)img >= data.images.size()) return 0;
+        if (data.images[img].aliasOf >= 0) img = data.images[img].aliasOf;
+        if (imageTexture[img] < 0) {
+            EncodedTexture tex;
+            imageTexture[img] = encodeImage(data.images[img], caps, tex) ? (int)encoded.size() : 0;
+            if (imageTexture[img]) encoded.push_back(std::move(tex));
+        }
+        return imageTexture[img];
+    };
+    auto samplerOf = [&](int texture) {
+        return texture >= 0 && (size_t)texture < data.textureSampler.size()
+             ? data.textureSampler[texture] : SamplerDesc{};
+    };
+
+    // Meshes and their materials (base color + normal map, each with a sampler)
+    struct Material { int base, normal; VkSampler baseSampler, normalSampler; };
+    std::vector<Material> materialDescs;
+    std::map<std::tuple<int, int, VkSampler, VkSampler>, size_t> materialIndex;
+    size_t vertCount = 0, indexCount = 0;
+    for (size_t i = 0; i < data.primitives.size(); ++i) {
+        auto& p = data.primitives[i];
+        Material m{textureOf(p.texture), textureOf(p.normalTexture),
+                   samplerFor(samplerOf(p.texture)), samplerFor(samplerOf(p.normalTexture))};
+        auto key = std::make_tuple(m.base, m.normal, m.baseSampler, m.normalSampler);
+        auto it = materialIndex.emplace(key, materialDescs.size()).first;
+        if (it->second == materialDescs.size()) materialDescs.push_back(m);
+
+        GpuMesh mesh;
+        mesh.firstIndex = (uint32_t)indexCount;
+        mesh.baseVertex = (int32_t)vertCount;
+        mesh.count      = (uint32_t)p.indices.size();
+        mesh.drawId     = (uint32_t)i;
+        mesh.node       = p.node;
+        mesh.skin       = p.skin;
+        mesh.material   = it->second;
+        mesh.blend      = p.blend;
+        meshes.push_back(mesh);
+        vertCount  += p.verts.size() / VRMPrimitiveData::kStride;
+        indexCount += p.indices.size();
+    }
+    // Only opaque and alpha-tested meshes may be reordered; blended ones
+    // composite in file order after them
+    auto blended = std::stable_partition(meshes.begin(), meshes.end(),
+                                         [](const GpuMesh& m) { return !m.blend; });
+    std::stable_sort(meshes.begin(), blended,
+                     [](const GpuMesh& a, const GpuMesh& b) { return a.material < b.material; });
+
+    // Staging layout: vertices | draw ids | indices | texture levels
+    const VkDeviceSize vertBytes = vertCount * VRMPrimitiveData::kStride * sizeof(float);
+    drawIdOffset = vertBytes;
+    indexOffset  = alignUp(drawIdOffset + vertCount * sizeof(uint32_t), kStagingAlign);
+    const VkDeviceSize geometryBytes = indexOffset + indexCount * sizeof(uint32_t);
+    VkDeviceSize stagingBytes = alignUp(geometryBytes, kStagingAlign);
+    for (auto& t : encoded)
+        for (auto& l : t.levels) stagingBytes += alignUp(l.data.size(), kStagingAlign);
+
+    Buffer staging;
+    if (!createBuffer(stagingBytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                      staging) ||
+        !createBuffer(geometryBytes, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+                      VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, geometry)) {
+        destroyBuffer(staging);
+        return false;
+    }
+    char* dst = (char*)staging.mapped;
+    VkDeviceSize vertAt = 0, idAt = drawIdOffset, indexAt = indexOffset;
+    for (size_t i = 0; i < data.primitives.size(); ++i) {
+        auto& p = data.primitives[i];
+        const size_t n = p.verts.size() / VRMPrimitiveData::kStride;
+        std::memcpy(dst + vertAt, p.verts.data(), p.verts.size() * sizeof(float));
+        std::fill_n((uint32_t*)(dst + idAt), n, (uint32_t)i);
+        std::memcpy(dst + indexAt, p.indices.data(), p.indices.size() * sizeof(uint32_t));
+        vertAt  += p.verts.size() * sizeof(float);
+        idAt    += n * sizeof(uint32_t);
+        indexAt += p.indices.size() * sizeof(uint32_t);
+    }
+
+    VkCommandBuffer cmd = beginOneShot();
+    if (!cmd) {
+        destroyBuffer(staging);
+        return false;
+    }
+    VkBufferCopy geometryCopy{0, 0, geometryBytes};
+    vkCmdCopyBuffer(cmd, staging.buffer, geometry.buffer, 1, &geometryCopy);
+
+    VkDeviceSize at = alignUp(geometryBytes, kStagingAlign);
+    textures.resize(encoded.size());
+    bool ok = true;
+    for (size_t t = 0; t < encoded.size() && ok; ++t) {
+        const auto& tex = encoded[t];
+        const uint32_t levels = (uint32_t)tex.levels.size();
+        ok = createImage(tex.levels[0].width, tex.levels[0].height, levels, toVkFormat(tex.format),
+                         VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+                         VK_IMAGE_ASPECT_COLOR_BIT, textures[t]);
+        if (!ok) break;
+        imageBarrier(cmd, textures[t].image, levels,
+                     VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                     0, VK_ACCESS_TRANSFER_WRITE_BIT,
+                     VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        std::vector<VkBufferImageCopy> copies;
+        for (uint32_t l = 0; l < levels; ++l) {
+            const auto& level = tex.levels[l];
+            std::memcpy(dst + at, level.data.data(), level.data.size());
+            VkBufferImageCopy c{};
+            c.bufferOffset     = at;
+            c.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, l, 0, 1};
+            c.imageExtent      = {(uint32_t)level.width, (uint32_t)level.height, 1};
+            copies.push_back(c);
+            at += alignUp(level.data.size(), kStagingAlign);
+        }
+        vkCmdCopyBufferToImage(cmd, staging.buffer, textures[t].image,
+                               VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               (uint32_t)copies.size(), copies.data());
+        imageBarrier(cmd, textures[t].image, levels,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+                     VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+                     VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+    }
+    VkBufferMemoryBarrier geometryBarrier{};
+    geometryBarrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    geometryBarrier.srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT;
+    geometryBarrier.dstAccessMask       = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT;
+    geometryBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    geometryBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    geometryBarrier.buffer              = geometry.buffer;
+    geometryBarrier.size                = VK_WHOLE_SIZE;
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT,
+                         0, 0, nullptr, 1, &geometryBarrier, 0, nullptr);
+    ok = submitOneShot(cmd) && ok;
+    destroyBuffer(staging);
+    if (!ok) return false;
+
+    // One descriptor set per material, written once
+    if (!materialDescs.empty()) {
+        VkDescriptorPoolSize size{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+                                  (uint32_t)(2 * materialDescs.size())};
+        VkDescriptorPoolCreateInfo dpci{};
+        dpci.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        dpci.maxSets       = (uint32_t)materialDescs.size();
+        dpci.poolSizeCount = 1;
+        dpci.pPoolSizes    = &size;
+        if (!vkCheck(vkCreateDescriptorPool(device, &dpci, nullptr, &materialPool),
+                     "vkCreateDescriptorPool"))
+            return false;
+        std::vector<VkDescriptorSetLayout> layouts(materialDescs.size(), materialLayout);
+        materials.resize(materialDescs.size());
+        VkDescriptorSetAllocateInfo dsai{};
+        dsai.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        dsai.descriptorPool     = materialPool;
+        dsai.descriptorSetCount = (uint32_t)layouts.size();
+        dsai.pSetLayouts        = layouts.data();
+        if (!vkCheck(vkAllocateDescriptorSets(device, &dsai, materials.data()),
+                     "vkAllocateDescriptorSets"))
+            return false;
+
+        for (size_t m = 0; m < materialDescs.size(); ++m) {
+            const Material& d = materialDescs[m];
+            VkDescriptorImageInfo images[2] = {
+                {d.baseSampler, textures[d.base].view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL},
+                {d.normalSampler, textures[d.normal].view, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL},
+            };
+            VkWriteDescriptorSet w{};
+            w.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+            w.dstSet          = materials[m];
+            w.dstBinding      = 0;
+            w.descriptorCount = 2;
+            w.descriptorType  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            w.pImageInfo      = images;
+            vkUpdateDescriptorSets(device, 1, &w, 0, nullptr);
+        }
+    }
+    // The white fallback is not a valid normal map
+    for (auto& mesh : meshes) mesh.normalMapped = materialDescs[mesh.material].normal != 0;
+
+    FT_LOG(Info, "Renderer: uploaded {} meshes, {} textures, {} materials ({} MB staged)",
+           meshes.size(), textures.size() - 1, materialDescs.size(), stagingBytes / 1e6);
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// Frames
+
+void VulkanRenderer::invalidateRecordings() {
+    for (FrameSlot& f : frames) f.recorded = false;
+}
+
+// Grows the slot's storage buffers (the slot must be idle) and points its
+// descriptor set at them
+bool VulkanRenderer::ensureCapacity(FrameSlot& f, VkDeviceSize drawBytes, VkDeviceSize jointBytes) {
+    bool changed = !f.draws.buffer;
+    const VkMemoryPropertyFlags hostVisible =
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    if (drawBytes > f.draws.size) {
+        destroyBuffer(f.draws);
+        if (!createBuffer(drawBytes, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, hostVisible, f.draws))
+            return false;
+        changed = true;
+    }
+    if (jointBytes > f.joints.size) {
+        destroyBuffer(f.joints);
+        if (!createBuffer(jointBytes, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, hostVisible, f.joints))
+            return false;
+        changed = true;
+    }
+    if (!changed) return true;
+
+    VkDescriptorBufferInfo infos[3] = {
+        {f.uniforms.buffer, 0, VK_WHOLE_SIZE},
+        {f.draws.buffer,    0, VK_WHOLE_SIZE},
+        {f.joints.buffer,   0, VK_WHOLE_SIZE},
+    };
+    VkWriteDescriptorSet w[3]{};
+    for (uint32_t b = 0; b < 3; ++b) {
+        w[b].sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        w[b].dstSet          = f.set;
+        w[b].dstBinding      = b;
+        w[b].descriptorCount = 1;
+        w[b].descriptorType  = b == 0 ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+                                      : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        w[b].pBufferInfo     = &infos[b];
+    }
+    vkUpdateDescriptorSets(device, 3, w, 0, nullptr);
+    // Recorded commands referenced the old set contents
+    f.recorded = false;
+    return true;
+}
+
+void VulkanRenderer::record(FrameSlot& f) {
+    vkResetCommandBuffer(f.cmd, 0);
+    VkCommandBufferBeginInfo bi{};
+    bi.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    vkBeginCommandBuffer(f.cmd, &bi);
+
+    VkClearValue clears[2]{};
+    clears[1].depthStencil = {1.0f, 0};
+    VkRenderPassBeginInfo rbi{};
+    rbi.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
+    rbi.renderPass      = renderPass;
+    rbi.framebuffer     = framebuffer;
+    rbi.renderArea      = {{0, 0}, {(uint32_t)width, (uint32_t)height}};
+    rbi.clearValueCount = 2;
+    rbi.pClearValues    = clears;
+    vkCmdBeginRenderPass(f.cmd, &rbi, VK_SUBPASS_CONTENTS_INLINE);
+
+    if (!meshes.empty()) {
+        VkViewport vp{0.0f, 0.0f, (float)width, (float)height, 0.0f, 1.0f};
+        VkRect2D scissor{{0, 0}, {(uint32_t)width, (uint32_t)height}};
+        vkCmdSetViewport(f.cmd, 0, 1, &vp);
+        vkCmdSetScissor(f.cmd, 0, 1, &scissor);
+        vkCmdBindPipeline(f.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+
+        VkBuffer     vbs[2]     = {geometry.buffer, geometry.buffer};
+        VkDeviceSize offsets[2] = {0, drawIdOffset};
+        vkCmdBindVertexBuffers(f.cmd, 0, 2, vbs, offsets);
+        vkCmdBindIndexBuffer(f.cmd, geometry.buffer, indexOffset, VK_INDEX_TYPE_UINT32);
+        vkCmdBindDescriptorSets(f.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout,
+                                0, 1, &f.set, 0, nullptr);
+
+        // Meshes are grouped by material, so sets only change between groups
+        size_t bound = SIZE_MAX;
+        for (const GpuMesh& m : meshes) {
+            if (m.material != bound) {
+                vkCmdBindDescriptorSets(f.cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, pipelineLayout,
+                                        1, 1, &materials[m.material], 0, nullptr);
+                bound = m.material;
+            }
+            vkCmdDrawIndexed(f.cmd, m.count, f.instances, m.firstIndex, m.baseVertex, 0);
+        }
+    }
+
+    vkCmdEndRenderPass(f.cmd);
+    vkEndCommandBuffer(f.cmd);
+    f.recorded = true;
+}
+
+void VulkanRenderer::drawFrame(const FrameState& frame) {
+    FrameSlot& f = frames[frameIndex];
+    frameIndex = (frameIndex + 1) % kFramesInFlight;
+    vkWaitForFences(device, 1, &f.fence, VK_TRUE, UINT64_MAX);
+
+    // Per-draw state and joints, same layout as the GL draw table: one run
+    // of meshes.size() entries per instance
+    const size_t draws = meshes.size();
+    drawTable.assign(std::max<size_t>(1, frame.instances.size() * draws) * kTexelsPerDraw,
+                     glm::vec4(0.0f));
+    jointMats.clear();
+    for (size_t i = 0; i < frame.instances.size(); ++i) {
+        const InstanceState& inst = frame.instances[i];
+        const int instanceBase = (int)jointMats.size();
+        skinOffsets.clear();
+        if (inst.pose) inst.pose->jointPalette(jointMats, skinOffsets);
+        for (const GpuMesh& m : meshes) {
+            // Skinned meshes get their placement from the joints; rigid ones
+            // follow their node
+            glm::mat4 meshModel = inst.model;
+            if (m.skin < 0 && m.node >= 0 && inst.pose) meshModel = inst.model * inst.pose->world(m.node);
+            int jointBase = m.skin >= 0 && m.skin < (int)skinOffsets.size()
+                          ? instanceBase + skinOffsets[m.skin] : 0;
+            glm::vec4* t = &drawTable[(i * draws + m.drawId) * kTexelsPerDraw];
+            for (int c = 0; c < 4; ++c) t[c] = meshModel[c];
+            t[4] = glm::vec4(m.skin >= 0 && inst.pose ? 1.0f : 0.0f, (float)jointBase, 0.0f,
+                             m.normalMapped ? 1.0f : 0.0f);
+        }
+    }
+    if (jointMats.empty()) jointMats.push_back(glm::mat4(1.0f));
+    const VkDeviceSize drawBytes  = drawTable.size() * sizeof(glm::vec4);
+    const VkDeviceSize jointBytes = jointMats.size() * sizeof(glm::mat4);
+    if (!ensureCapacity(f, drawBytes, jointBytes)) return;
+
+    FrameUniforms u{frame.view, frame.proj, glm::vec4(frame.lightDir, 0.0f),
+                    glm::vec4(frame.ambient, 0.0f), (uint32_t)draws, {0, 0, 0}};
+    std::memcpy(f.uniforms.mapped, &u, sizeof(u));
+    std::memcpy(f.draws.mapped, drawTable.data(), drawBytes);
+    std::memcpy(f.joints.mapped, jointMats.data(), jointBytes);
+
+    // The command buffer is replayed as is unless something it references changed
+    if (!f.recorded || f.instances != frame.instances.size()) {
+        f.instances = (uint32_t)frame.instances.size();
+        record(f);
+    }
+
+    vkResetFences(device, 1, &f.fence);
+    VkSubmitInfo si{};
+    si.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    si.commandBufferCount = 1;
+    si.pCommandBuffers    = &f.cmd;
+    if (vkCheck(vkQueueSubmit(queue, 1, &si, f.fence), "vkQueueSubmit")) rendered = true;
+}
+
+void VulkanRenderer::resize(int w, int h) {
+    if (w == width && h == height) return;
+    vkDeviceWaitIdle(device);
+    destroyTargets();
+    createTargets(w, h);
+    invalidateRecordings();
+}
+
+void VulkanRenderer::finish() {
+    vkQueueWaitIdle(queue);
+}
+
+bool VulkanRenderer::readPixels(std::vector<unsigned char>& rgba, int& w, int& h) {
+    if (!rendered) return false;
+    finish();
+    Buffer readback;
+    const VkDeviceSize bytes = (VkDeviceSize)width * height * 4;
+    if (!createBuffer(bytes, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+                      VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                      readback))
+        return false;
+    VkCommandBuffer cmd = beginOneShot();
+    if (!cmd) {
+        destroyBuffer(readback);
+        return false;
+    }
+    // The render pass leaves the color attachment in TRANSFER_SRC_OPTIMAL
+    VkBufferImageCopy c{};
+    c.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    c.imageExtent      = {(uint32_t)width, (uint32_t)height, 1};
+    vkCmdCopyImageToBuffer(cmd, color.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           readback.buffer, 1, &c);
+    bool ok = submitOneShot(cmd);
+    if (ok) {
+        w = width;
+        h = height;
+        const unsigned char* p = (const unsigned char*)readback.mapped;
+        rgba.assign(p, p + bytes);
+    }
+    destroyBuffer(readback);
+    return ok;
+}
+
+#endif // FT_HAVE_VULKAN
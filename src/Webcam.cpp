@@ -0,0 +1,328 @@
+#include "Webcam.hpp"
+#include "Log.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <fcntl.h>
+#include <linux/videodev2.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+const char* const kWebcamUsage =
+    " [--camera-size WxH] [--camera-fps N] [--camera-format FOURCC]"
+    " [--exposure auto|fps|N] [--gain N] [--white-balance auto|K] [--save-camera-profile]";
+
+// The achieved rate is measured over windows this long
+static constexpr auto kFpsWindow = std::chrono::seconds(2);
+
+// Below this share of the requested rate, a window counts as slow; two in a
+// row trigger a warning and an adaptation step
+static constexpr double kSlowFraction = 0.85;
+
+// UVC exposure_auto menu values
+static constexpr int kExposureManual   = V4L2_EXPOSURE_MANUAL;
+static constexpr int kExposureAperture = V4L2_EXPOSURE_APERTURE_PRIORITY;
+
+static bool parseInt(const std::string& v, int& out) {
+    char* end = nullptr;
+    long n = std::strtol(v.c_str(), &end, 10);
+    if (v.empty() || *end) return false;
+    out = (int)n;
+    return true;
+}
+
+bool parseWebcamOption(WebcamSettings& s, const std::string& key, const std::string& value) {
+    if (key == "size") {
+        int w = 0, h = 0;
+        if (std::sscanf(value.c_str(), "%dx%d", &w, &h) != 2 || w <= 0 || h <= 0) return false;
+        s.width = w;
+        s.height = h;
+        return true;
+    }
+    if (key == "fps") {
+        double fps = std::atof(value.c_str());
+        if (fps <= 0) return false;
+        s.fps = fps;
+        return true;
+    }
+    if (key == "format") {
+        if (value.size() != 4) return false;
+        s.format = value;
+        return true;
+    }
+    if (key == "exposure") {
+        if (value == "auto") { s.exposure = ExposureMode::Auto; return true; }
+        if (value == "fps")  { s.exposure = ExposureMode::KeepFrameRate; return true; }
+        int t = 0;
+        if (!parseInt(value, t) || t <= 0) return false;
+        s.exposure = ExposureMode::Manual;
+        s.exposureTime = t;
+        return true;
+    }
+    if (key == "gain") return parseInt(value, s.gain) && s.gain >= 0;
+    if (key == "white_balance") {
+        if (value == "auto") { s.whiteBalance = 0; return true; }
+        return parseInt(value, s.whiteBalance) && s.whiteBalance > 0;
+    }
+    return false;
+}
+
+bool parseWebcamArg(int argc, char** argv, int& i, WebcamSettings& s) {
+    static const struct { const char* flag; const char* key; } flags[] = {
+        {"--camera-size", "size"}, {"--camera-fps", "fps"}, {"--camera-format", "format"},
+        {"--exposure", "exposure"}, {"--gain", "gain"}, {"--white-balance", "white_balance"},
+    };
+    for (const auto& f : flags) {
+        if (std::strcmp(argv[i], f.flag) || i + 1 >= argc) continue;
+        if (!parseWebcamOption(s, f.key, argv[i + 1])) return false;
+        ++i;
+        return true;
+    }
+    return false;
+}
+
+// Explicit settings in `over` replace those in `base`
+static void overlay(WebcamSettings& base, const WebcamSettings& over) {
+    if (over.width > 0) { base.width = over.width; base.height = over.height; }
+    if (over.fps > 0) base.fps = over.fps;
+    if (!over.format.empty()) base.format = over.format;
+    if (over.exposure != ExposureMode::Unset) {
+        base.exposure = over.exposure;
+        base.exposureTime = over.exposureTime;
+    }
+    if (over.gain >= 0) base.gain = over.gain;
+    if (over.whiteBalance >= 0) base.whiteBalance = over.whiteBalance;
+}
+
+static fs::path profileDir() {
+    if (const char* xdg = std::getenv("XDG_CONFIG_HOME"); xdg && *xdg)
+        return fs::path(xdg) / "freetuber" / "cameras";
+    if (const char* home = std::getenv("HOME"); home && *home)
+        return fs::path(home) / ".config" / "freetuber" / "cameras";
+    return {};
+}
+
+static bool loadProfile(const std::string& device, WebcamSettings& out) {
+    fs::path dir = profileDir();
+    if (dir.empty()) return false;
+    std::ifstream f(dir / (device + ".conf"));
+    if (!f) return false;
+    std::string line;
+    while (std::getline(f, line)) {
+        size_t eq = line.find('=');
+        if (line.empty() || line[0] == '#' || eq == std::string::npos) continue;
+        if (!parseWebcamOption(out, line.substr(0, eq), line.substr(eq + 1)))
+            FT_LOG(Warn, "Camera profile {}: ignoring \"{}\"", device, line);
+    }
+    return true;
+}
+
+static std::string fourccString(double v) {
+    int c = (int)v;
+    std::string s;
+    if (c <= 0) return s;
+    for (int i = 0; i < 4; ++i) s += (char)((c >> (8 * i)) & 0xff);
+    return s;
+}
+
+Webcam::~Webcam() {
+    if (fd >= 0) close(fd);
+}
+
+bool Webcam::open(int index, const WebcamSettings& settings) {
+    std::string node = "/dev/video" + std::to_string(index);
+    fd = ::open(node.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) FT_LOG(Warn, "Camera: cannot open {} for controls: {}", node, std::strerror(errno));
+
+    // Card name and bus position tell identical models on different ports apart
+    device = "video" + std::to_string(index);
+    v4l2_capability caps{};
+    if (fd >= 0 && ioctl(fd, VIDIOC_QUERYCAP, &caps) == 0) {
+        device = std::string((const char*)caps.card) + "-" + (const char*)caps.bus_info;
+        for (char& c : device)
+            if (!std::isalnum((unsigned char)c) && c != '-') c = '_';
+    }
+
+    WebcamSettings want;
+    want.exposure = ExposureMode::KeepFrameRate;
+    if (loadProfile(device, want)) FT_LOG(Info, "Camera: using profile {}", device);
+    overlay(want, settings);
+
+    if (!cap.open(index, cv::CAP_V4L2) && !cap.open(index)) {
+        FT_LOG(Error, "Camera: cannot open camera {}", index);
+        return false;
+    }
+    // The format goes first: it decides which sizes and rates exist
+    if (want.format.size() == 4)
+        cap.set(cv::CAP_PROP_FOURCC, cv::VideoWriter::fourcc(want.format[0], want.format[1],
+                                                             want.format[2], want.format[3]));
+    if (want.width > 0) {
+        cap.set(cv::CAP_PROP_FRAME_WIDTH, want.width);
+        cap.set(cv::CAP_PROP_FRAME_HEIGHT, want.height);
+    }
+    if (want.fps > 0) cap.set(cv::CAP_PROP_FPS, want.fps);
+    cap.set(cv::CAP_PROP_BUFFERSIZE, 1);
+
+    active = want;
+    active.width  = (int)cap.get(cv::CAP_PROP_FRAME_WIDTH);
+    active.height = (int)cap.get(cv::CAP_PROP_FRAME_HEIGHT);
+    active.fps    = cap.get(cv::CAP_PROP_FPS);
+    active.format = fourccString(cap.get(cv::CAP_PROP_FOURCC));
+    if (want.fps > 0 && active.fps + 0.5 < want.fps)
+        FT_LOG(Warn, "Camera: asked for {} fps, driver offers {} at {}x{} {}",
+               want.fps, active.fps, active.width, active.height, active.format);
+
+    applyExposure();
+    if (active.gain >= 0) setControl(V4L2_CID_GAIN, active.gain, "gain");
+    if (active.whiteBalance == 0) {
+        setControl(V4L2_CID_AUTO_WHITE_BALANCE, 1, "auto white balance");
+    } else if (active.whiteBalance > 0) {
+        setControl(V4L2_CID_AUTO_WHITE_BALANCE, 0, "auto white balance");
+        setControl(V4L2_CID_WHITE_BALANCE_TEMPERATURE, active.whiteBalance, "white balance");
+    }
+
+    FT_LOG(Info, "Camera {}: {}x{} {} at {} fps", device, active.width, active.height,
+           active.format, active.fps);
+    windowStart = std::chrono::steady_clock::now();
+    return true;
+}
+
+bool Webcam::setControl(unsigned id, int value, const char* name) {
+    if (fd < 0) return false;
+    v4l2_queryctrl q{};
+    q.id = id;
+    if (ioctl(fd, VIDIOC_QUERYCTRL, &q) != 0 || (q.flags & V4L2_CTRL_FLAG_DISABLED)) {
+        FT_LOG(Debug, "Camera: no {} control", name);
+        return false;
+    }
+    v4l2_control c{};
+    c.id    = id;
+    c.value = std::clamp(value, q.minimum, q.maximum);
+    if (ioctl(fd, VIDIOC_S_CTRL, &c) != 0) {
+        FT_LOG(Warn, "Camera: setting {} to {} failed: {}", name, c.value, std::strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool Webcam::getControl(unsigned id, int& value) const {
+    v4l2_control c{};
+    c.id = id;
+    if (fd < 0 || ioctl(fd, VIDIOC_G_CTRL, &c) != 0) return false;
+    value = c.value;
+    return true;
+}
+
+void Webcam::applyExposure() {
+    switch (active.exposure) {
+        case ExposureMode::Unset:
+            break;
+        case ExposureMode::Auto:
+            setControl(V4L2_CID_EXPOSURE_AUTO, kExposureAperture, "auto exposure");
+            setControl(V4L2_CID_EXPOSURE_AUTO_PRIORITY, 1, "exposure priority");
+            break;
+        case ExposureMode::KeepFrameRate:
+            setControl(V4L2_CID_EXPOSURE_AUTO, kExposureAperture, "auto exposure");
+            setControl(V4L2_CID_EXPOSURE_AUTO_PRIORITY, 0, "exposure priority");
+            break;
+        case ExposureMode::Manual:
+            setControl(V4L2_CID_EXPOSURE_AUTO, kExposureManual, "auto exposure");
+            setControl(V4L2_CID_EXPOSURE_ABSOLUTE, active.exposureTime, "exposure time");
+            if (active.fps > 0 && active.exposureTime * 1e-4 > 1.0 / active.fps)
+                FT_LOG(Warn, "Camera: exposure of {} ms is longer than a frame at {} fps",
+                       active.exposureTime / 10.0, active.fps);
+            break;
+    }
+}
+
+bool Webcam::read(cv::Mat& frame) {
+    if (!cap.read(frame) || frame.empty()) return false;
+
+    ++windowFrames;
+    auto now = std::chrono::steady_clock::now();
+    if (now - windowStart < kFpsWindow) return true;
+    double secs = std::chrono::duration<double>(now - windowStart).count();
+    measuredFps  = windowFrames / secs;
+    windowFrames = 0;
+    windowStart  = now;
+
+    // The first window includes the camera starting up
+    if (firstWindow) { firstWindow = false; return true; }
+    if (active.fps > 0 && measuredFps < active.fps * kSlowFraction) {
+        if (++slowWindows >= 2) {
+            onSlowWindow();
+            slowWindows = 0;
+        }
+    } else {
+        slowWindows = 0;
+    }
+    return true;
+}
+
+// The camera has been delivering too few frames for a while: remove the
+// exposure setting that explains it, or say what else could
+void Webcam::onSlowWindow() {
+    static LogRateLimit slowLog(30000);
+    if (slowLog.allow())
+        logWrite(LogLevel::Warn, slowLog.takeSuppressed(), "Camera: delivering {} of {} fps",
+                 measuredFps, active.fps);
+
+    if (active.exposure == ExposureMode::Auto || active.exposure == ExposureMode::Unset) {
+        FT_LOG(Info, "Camera: keeping auto exposure from lowering the frame rate");
+        active.exposure = ExposureMode::KeepFrameRate;
+        applyExposure();
+    } else if (active.exposure == ExposureMode::Manual &&
+               active.exposureTime * 1e-4 > 0.9 / active.fps) {
+        // Shorten the exposure to fit the frame and make up with gain
+        int fitted = std::max(1, (int)(0.9e4 / active.fps));
+        int gain = 0;
+        if (getControl(V4L2_CID_GAIN, gain) && gain > 0) {
+            setControl(V4L2_CID_GAIN, (int)std::lround(gain * (double)active.exposureTime / fitted),
+                       "gain");
+            getControl(V4L2_CID_GAIN, active.gain);
+        }
+        FT_LOG(Info, "Camera: exposure {} -> {} ms to fit {} fps",
+               active.exposureTime / 10.0, fitted / 10.0, active.fps);
+        active.exposureTime = fitted;
+        applyExposure();
+    } else if (active.format == "YUYV") {
+        FT_LOG_EVERY_MS(Info, 60000, "Camera: uncompressed {}x{} may exceed the USB bandwidth;"
+                        " try --camera-format MJPG", active.width, active.height);
+    }
+}
+
+bool Webcam::saveProfile() const {
+    fs::path dir = profileDir();
+    if (dir.empty() || !isOpened()) return false;
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    fs::path path = dir / (device + ".conf");
+    std::ofstream f(path, std::ios::trunc);
+    f << "# FreeTuber camera profile for " << device << "\n";
+    f << "size=" << active.width << "x" << active.height << "\n";
+    f << "fps=" << active.fps << "\n";
+    f << "format=" << active.format << "\n";
+    switch (active.exposure) {
+        case ExposureMode::Auto:          f << "exposure=auto\n"; break;
+        case ExposureMode::KeepFrameRate: f << "exposure=fps\n"; break;
+        case ExposureMode::Manual:        f << "exposure=" << active.exposureTime << "\n"; break;
+        case ExposureMode::Unset:         break;
+    }
+    if (active.gain >= 0) f << "gain=" << active.gain << "\n";
+    if (active.whiteBalance == 0) f << "white_balance=auto\n";
+    else if (active.whiteBalance > 0) f << "white_balance=" << active.whiteBalance << "\n";
+    if (!f) {
+        FT_LOG(Warn, "Camera: failed to write profile {}", path.string());
+        return false;
+    }
+    FT_LOG(Info, "Camera: saved profile {}", path.string());
+    return true;
+}
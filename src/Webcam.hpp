@@ -0,0 +1,71 @@
+#pragma once
+#include <chrono>
+#include <string>
+#include <opencv2/opencv.hpp>
+
+// Auto exposure on most UVC webcams stretches the exposure time in dim
+// light and silently drops to 15 fps or less; KeepFrameRate keeps auto
+// exposure but forbids that.
+enum class ExposureMode { Unset, Auto, KeepFrameRate, Manual };
+
+// What to ask of the camera. Unset fields (negative, empty) leave the
+// driver's choice alone.
+struct WebcamSettings {
+    int          width = -1, height = -1;
+    double       fps = -1;
+    std::string  format;                 // FOURCC, e.g. "MJPG" or "YUYV"
+    ExposureMode exposure = ExposureMode::Unset;
+    int          exposureTime = -1;      // Manual, in V4L2 units of 100 us
+    int          gain = -1;
+    int          whiteBalance = -1;      // Kelvin; 0 = auto
+};
+
+// Parses one setting by its profile key (size, fps, format, exposure, gain,
+// white_balance), e.g. ("size", "1280x720") or ("exposure", "fps")
+bool parseWebcamOption(WebcamSettings& s, const std::string& key, const std::string& value);
+
+// Consumes a camera flag (--camera-size, --camera-fps, --camera-format,
+// --exposure, --gain, --white-balance) and its value at argv[i]
+bool parseWebcamArg(int argc, char** argv, int& i, WebcamSettings& s);
+
+extern const char* const kWebcamUsage;
+
+// V4L2 webcam with explicit format, frame rate and exposure control.
+// Settings are layered over the device's saved profile
+// ($XDG_CONFIG_HOME/freetuber/cameras/<device>.conf); explicit ones win.
+class Webcam {
+public:
+    ~Webcam();
+
+    bool open(int index, const WebcamSettings& settings = {});
+    bool isOpened() const { return cap.isOpened(); }
+
+    // Next frame. Also watches the achieved frame rate; when the camera
+    // under-delivers it warns and, where exposure is the cause, adapts it.
+    bool read(cv::Mat& frame);
+
+    // Saves the settings in effect as this device's profile
+    bool saveProfile() const;
+
+    double achievedFps() const { return measuredFps; }
+    const WebcamSettings& settings() const { return active; }
+    const std::string& deviceId() const { return device; }
+
+private:
+    bool setControl(unsigned id, int value, const char* name);
+    bool getControl(unsigned id, int& value) const;
+    void applyExposure();
+    void onSlowWindow();
+
+    cv::VideoCapture cap;
+    int              fd = -1;           // V4L2 controls, alongside OpenCV's handle
+    std::string      device;
+    WebcamSettings   active;
+
+    // Achieved frame rate, over windows of about two seconds
+    std::chrono::steady_clock::time_point windowStart;
+    int    windowFrames = 0;
+    int    slowWindows = 0;
+    bool   firstWindow = true;
+    double measuredFps = 0.0;
+};
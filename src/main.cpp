@@ -1,26 +1,33 @@
 #include <filesystem>
-#include <fstream>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
-#include "Shader.hpp"
 #include "VRMLoader.hpp"
+#include "ModelSwap.hpp"
+#include "Skeleton.hpp"
+#include "SpringBone.hpp"
+#include "GLRenderer.hpp"
+#include "GpuPreprocess.hpp"
+#include "AllocCounter.hpp"
+#include "Avatar.hpp"
+#include "ModelLibrary.hpp"
+#include "ThreadPool.hpp"
+#include "GltfAccessor.hpp"
 #include "HeadPose.hpp"
 #include "Camera.hpp"
+#include "PoseChannel.hpp"
+#include "Webcam.hpp"
+#include "Log.hpp"
+#include "Startup.hpp"
 #include <opencv2/opencv.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 #include <iostream>
-#include "EmbeddedResources.hpp"  // Embedded shaders + cascade XML
-
-// Pre‐rotate avatar 180° so it faces the camera
-static const glm::mat4 modelMat = glm::rotate(
-    glm::mat4(1.0f), glm::radians(180.0f),
-    glm::vec3(0,1,0)
-);
-
-// Head‐pose smoothing
-static const float smoothAlpha = 0.1f;
-static glm::quat prevHeadQuat(1,0,0,0);
+#include <future>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include "EmbeddedResources.hpp"  // Embedded shaders + cascade
 
 static std::filesystem::path getExeDir(const char* argv0) {
     std::filesystem::path p(argv0);
@@ -30,10 +37,12 @@ static std::filesystem::path getExeDir(const char* argv0) {
     return p.parent_path();
 }
 
+static Renderer* activeRenderer = nullptr;
+
 static void framebuffer_size_callback(GLFWwindow* w,int w_,int h_) {
     auto cam = static_cast<Camera*>(glfwGetWindowUserPointer(w));
     if (cam) cam->resize(w_, h_);
-    glViewport(0, 0, w_, h_);
+    if (activeRenderer) activeRenderer->resize(w_, h_);
 }
 static void mouse_button_callback(GLFWwindow* w,int b,int a,int){
     double x,y; glfwGetCursorPos(w,&x,&y);
@@ -49,38 +58,381 @@ static void scroll_callback(GLFWwindow* w,double,double yoff){
     if (cam) cam->scroll(yoff);
 }
 
-int main(int argc, char** argv) {
-    if (argc < 2) {
-        std::cerr << "Usage: " << argv[0] << " model.vrm\n";
-        return 1;
-    }
+// Runtime model switching: drop a .vrm onto the window, or press R to reload
+static ModelSwapper* modelSwapper = nullptr;
+static bool watchModelFile = false;
+
+// Where camera frames are reduced for tracking; G switches
+static bool preprocessOnGpu = false;
 
-    // Write embedded Haar cascade XML to temp file for OpenCV
-    std::filesystem::path cascadeTempPath = std::filesystem::temp_directory_path() / "embedded_haarcascade.xml";
-    {
-        std::ofstream out(cascadeTempPath, std::ios::binary);
-        out << haarCascadeXml;
+static void drop_callback(GLFWwindow*,int count,const char** paths){
+    if (!modelSwapper || count < 1) return;
+    modelSwapper->request(paths[0]);
+    if (watchModelFile) modelSwapper->watch(paths[0]);
+}
+static void key_callback(GLFWwindow*,int key,int,int action,int){
+    if (modelSwapper && key == GLFW_KEY_R && action == GLFW_PRESS)
+        modelSwapper->request(modelSwapper->currentPath());
+    // D switches face detectors (in-process tracking runs on this thread)
+    if (key == GLFW_KEY_D && action == GLFW_PRESS)
+        selectFaceDetector(activeFaceDetector() == FaceDetectorKind::YuNet
+                           ? FaceDetectorKind::Haar : FaceDetectorKind::YuNet);
+    if (key == GLFW_KEY_G && action == GLFW_PRESS) {
+        preprocessOnGpu = !preprocessOnGpu;
+        FT_LOG(Info, "Preprocess: {}", preprocessOnGpu ? "gpu" : "cpu");
     }
-    initHeadPose(cascadeTempPath.string());
+}
 
-    // GLFW + GLAD initialization
-    if (!glfwInit()) return -1;
-    auto window = glfwCreateWindow(800,600,"FreeTuber",nullptr,nullptr);
+// Window with a current, loaded GL context. Prefers a 4.5 core context for
+// the DSA / persistent-mapping path; takes whatever the driver offers by
+// default otherwise.
+static GLFWwindow* createGLWindow(bool visible, bool forceGL33) {
+    if (!glfwInit()) return nullptr;
+    GLFWwindow* window = nullptr;
+    glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+    if (!forceGL33) {
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        window = glfwCreateWindow(800,600,"FreeTuber",nullptr,nullptr);
+        glfwDefaultWindowHints();
+        glfwWindowHint(GLFW_VISIBLE, visible ? GLFW_TRUE : GLFW_FALSE);
+    }
+    if (!window) window = glfwCreateWindow(800,600,"FreeTuber",nullptr,nullptr);
     if (!window) {
-        std::cerr << "Failed to create GLFW window\n";
+        FT_LOG(Error, "Failed to create GLFW window");
         glfwTerminate();
-        return -1;
+        return nullptr;
     }
     glfwMakeContextCurrent(window);
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
-        std::cerr<<"GLAD init failed\n";
-        return -1;
+        FT_LOG(Error, "GLAD init failed");
+        glfwTerminate();
+        return nullptr;
     }
-    glDisable(GL_CULL_FACE);
+    return window;
+}
+
+// --bench-springs: simulate the model's spring bones headless and report
+// throughput single-threaded and on the pool.
+static int benchSpringBones(const char* path) {
+    VRMData vrm;
+    if (!parseVRM(path, vrm)) return 1;
+    const int steps = 2000;
+    double single = benchmarkSpringBones(vrm.skeleton, vrm.springBones, nullptr, steps);
+    double pooled = benchmarkSpringBones(vrm.skeleton, vrm.springBones,
+                                         &ThreadPool::shared(), steps);
+    FT_LOG(Info, "SpringBone bench: {} joints, {} steps", vrm.springBones.jointCount(), steps);
+    FT_LOG(Info, "  1 thread:  {} joints/ms", single);
+    FT_LOG(Info, "  {} threads: {} joints/ms", ThreadPool::shared().size() + 1, pooled);
+    return 0;
+}
+
+// --bench-render gl|vulkan: draw `instances` copies of the model headless
+// (hidden window for GL, offscreen for Vulkan), nodding out of step, and
+// report CPU submit time and frame rate. Runs on Mesa lavapipe/llvmpipe, so
+// it works in CI.
+static int benchRender(const char* path, const std::string& backend, int frames,
+                       int instances, bool forceGL33, const char* dumpPath, bool checkAllocs) {
+    VRMData vrm;
+    if (!parseVRM(path, vrm)) return 1;
+    Skeleton skeleton = vrm.skeleton;
 
-    // Enable blending for transparency
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    GLFWwindow* window = nullptr;
+    std::unique_ptr<Renderer> renderer;
+    if (backend == "vulkan") {
+        renderer = createVulkanRenderer(800, 600);
+    } else if (backend == "gl") {
+        if ((window = createGLWindow(false, forceGL33))) {
+            auto gl = std::make_unique<GLRenderer>((GLADloadproc)glfwGetProcAddress, !forceGL33);
+            if (gl->valid()) renderer = std::move(gl);
+        }
+    } else {
+        FT_LOG(Error, "Unknown renderer {} (gl or vulkan)", backend);
+    }
+    if (!renderer) {
+        if (window) glfwTerminate();
+        return 1;
+    }
+    renderer->resize(800, 600);
+
+    auto tUpload = std::chrono::steady_clock::now();
+    bool uploaded = renderer->upload(std::move(vrm));
+    if (!uploaded) {
+        renderer.reset();
+        if (window) glfwTerminate();
+        return 1;
+    }
+    renderer->finish();
+    double uploadMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - tUpload).count();
+
+    std::vector<SkeletonPose> poses(instances, SkeletonPose(skeleton));
+    Camera cam(800, 600);
+    FrameState frame;
+    frame.proj  = glm::perspective(glm::radians(45.0f), 800.0f/600.0f, 0.1f, 100.0f);
+    frame.view  = cam.getView();
+    for (int n = 0; n < instances; ++n)
+        frame.instances.push_back({avatarSlot(n, instances), &poses[n]});
+
+    // Frames after the first few (buffer growth, driver shader compiles)
+    // must not touch the heap
+    const int warmupFrames = std::min(frames / 2, 30);
+    FrameAllocCounter allocs;
+    double submitMs = 0.0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; ++i) {
+        if (i == warmupFrames) allocs = FrameAllocCounter();
+        for (int n = 0; n < instances; ++n) {
+            float nod = 0.3f * std::sin(i * 0.05f + n);
+            poses[n].setModelSpaceRotation(skeleton.headNode,
+                                           glm::angleAxis(nod, glm::vec3(1, 0, 0)));
+            poses[n].updateWorld();
+        }
+        auto tSubmit = std::chrono::steady_clock::now();
+        renderer->drawFrame(frame);
+        submitMs += std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - tSubmit).count();
+        if (i >= warmupFrames) allocs.lap();
+    }
+    renderer->finish();
+    double totalMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - t0).count();
+
+    FT_LOG(Info, "Render bench ({}): upload {} ms, {} frames of {} instances",
+           renderer->name(), uploadMs, frames, instances);
+    FT_LOG(Info, "  CPU submit {} ms/frame, {} frames/s including GPU",
+           submitMs / frames, frames / (totalMs / 1000.0));
+    FT_LOG(Info, "  heap: {} of {} frames after warm-up allocated ({} allocations)",
+           allocs.allocatingFrames, allocs.frames, allocs.allocations);
+
+    int rc = 0;
+    if (checkAllocs && allocs.allocatingFrames) {
+        FT_LOG(Error, "Render bench: steady-state frames allocated");
+        rc = 1;
+    }
+    if (dumpPath) {
+        std::vector<unsigned char> rgba;
+        int w = 0, h = 0;
+        std::ofstream ppm(dumpPath, std::ios::binary);
+        if (renderer->readPixels(rgba, w, h) && ppm) {
+            ppm << "P6\n" << w << " " << h << "\n255\n";
+            for (size_t p = 0; p < rgba.size(); p += 4) ppm.write((const char*)&rgba[p], 3);
+        }
+        if (!ppm) {
+            FT_LOG(Error, "Failed to write {}", dumpPath);
+            rc = 1;
+        }
+    }
+    renderer.reset();
+    if (window) glfwTerminate();
+    return rc;
+}
+
+// --bench-preprocess: reduces synthetic 1280x720 camera frames for tracking
+// on the CPU and through GpuPreprocessor (hidden window), and reports the CPU
+// time of each and how far the GPU's gray image is from the CPU's.
+static int benchPreprocess(int frames, bool forceGL33) {
+    GLFWwindow* window = createGLWindow(false, forceGL33);
+    if (!window) return 1;
+    auto gpu = std::make_unique<GpuPreprocessor>();
+    if (!gpu->valid()) {
+        gpu.reset();
+        glfwTerminate();
+        return 1;
+    }
+
+    // Smooth noise, shifted a pixel per variant so consecutive frames differ
+    const cv::Size size(1280, 720);
+    const int variants = 8;
+    cv::Mat base(size, CV_8UC3);
+    cv::RNG rng(1);
+    rng.fill(base, cv::RNG::UNIFORM, 0, 256);
+    cv::GaussianBlur(base, base, cv::Size(0, 0), 3.0);
+    std::vector<cv::Mat> inputs(variants);
+    for (int v = 0; v < variants; ++v) {
+        cv::Mat shift = (cv::Mat_<double>(2, 3) << 1, 0, v, 0, 1, 0);
+        cv::warpAffine(base, inputs[v], shift, size, cv::INTER_LINEAR, cv::BORDER_REFLECT);
+    }
+
+    // CPU: what estimateHead() does before tracking, pyramid included
+    TrackingFrame cpuFrame;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; ++i)
+        prepareTrackingFrame(inputs[i % variants], cpuFrame, true);
+    double cpuMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - t0).count();
+
+    // GPU: CPU time per call, and throughput once the GPU has caught up
+    TrackingFrame gpuFrame;
+    int ready = 0, last = -1;
+    double gpuCpuMs = 0.0;
+    t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; ++i) {
+        auto tCall = std::chrono::steady_clock::now();
+        if (gpu->process(inputs[i % variants], true, gpuFrame)) {
+            ++ready;
+            last = i - 1;
+        }
+        gpuCpuMs += std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - tCall).count();
+    }
+    glFinish();
+    double gpuWallMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - t0).count();
+
+    FT_LOG(Info, "Preprocess bench: {} frames of {}x{} to {}x{} gray + {}x{} color",
+           frames, size.width, size.height, cpuFrame.gray.cols, cpuFrame.gray.rows,
+           cpuFrame.color.cols, cpuFrame.color.rows);
+    FT_LOG(Info, "  CPU: {} ms/frame (convert, downscale, pyramid)", cpuMs / frames);
+    FT_LOG(Info, "  GPU: {} ms/frame of CPU time, {} frames/s including GPU, {} results",
+           gpuCpuMs / frames, frames / (gpuWallMs / 1000.0), ready);
+
+    int rc = 0;
+    if (last >= 0) {
+        // The last result is the frame queued one call earlier
+        prepareTrackingFrame(inputs[last % variants], cpuFrame, true);
+        cv::Mat diff;
+        cv::absdiff(cpuFrame.gray, gpuFrame.gray, diff);
+        double maxDiff = 0.0;
+        cv::minMaxLoc(diff, nullptr, &maxDiff);
+        FT_LOG(Info, "  gray difference GPU vs CPU: mean {}, max {} (of 255)",
+               cv::mean(diff)[0], maxDiff);
+    } else {
+        FT_LOG(Error, "Preprocess bench: no GPU results");
+        rc = 1;
+    }
+    gpu.reset();
+    glfwTerminate();
+    return rc;
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> modelPaths;
+    bool externalTracker = false;
+    bool benchSprings = false;
+    bool benchKtx2 = false;
+    bool benchAccessors = false;
+    bool benchPreprocessing = false;
+    bool forceGL33 = false;
+    std::string benchRenderer;
+    int benchFrames = 600;
+    int benchInstances = 1;
+    const char* dumpFrame = nullptr;
+    FaceDetectorKind detectorKind = defaultFaceDetector();
+    bool faceTracking = true;
+    bool motionGate = true;
+    bool checkAllocs = false;
+    WebcamSettings webcamSettings;
+    bool saveCameraProfile = false;
+    bool badArgs = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--external-tracker") externalTracker = true;
+        else if (arg == "--watch") watchModelFile = true;
+        else if (arg == "--bench-springs") benchSprings = true;
+        else if (arg == "--bench-ktx2") benchKtx2 = true;
+        else if (arg == "--bench-accessors") benchAccessors = true;
+        else if (arg == "--bench-preprocess") benchPreprocessing = true;
+        else if (arg == "--gl33") forceGL33 = true;
+        else if (arg == "--bench-render" && i + 1 < argc) benchRenderer = argv[++i];
+        else if (arg == "--frames" && i + 1 < argc) benchFrames = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--instances" && i + 1 < argc) benchInstances = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--dump-frame" && i + 1 < argc) dumpFrame = argv[++i];
+        else if (arg == "--detector" && i + 1 < argc && parseFaceDetector(argv[i + 1], detectorKind)) ++i;
+        else if (arg == "--no-klt") faceTracking = false;
+        else if (arg == "--no-motion-gate") motionGate = false;
+        else if (arg == "--preprocess" && i + 1 < argc && (std::string(argv[i + 1]) == "cpu" ||
+                                                          std::string(argv[i + 1]) == "gpu"))
+            preprocessOnGpu = std::string(argv[++i]) == "gpu";
+        else if (arg == "--check-allocs") checkAllocs = true;
+        else if (arg == "--save-camera-profile") saveCameraProfile = true;
+        else if (parseWebcamArg(argc, argv, i, webcamSettings)) continue;
+        else if (arg[0] != '-') modelPaths.push_back(arg);
+        else badArgs = true;
+    }
+    logInit();
+    if (benchAccessors && !badArgs) {
+        FT_LOG(Info, "glTF accessor conversion:");
+        benchmarkAccessorConversion();
+        return 0;
+    }
+    if (benchPreprocessing && !badArgs) return benchPreprocess(benchFrames, forceGL33);
+    if (modelPaths.empty() || badArgs) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--external-tracker] [--watch] [--gl33] [--detector yunet|haar]"
+                     " [--no-klt] [--no-motion-gate]\n"
+                     "       [--preprocess cpu|gpu]" << kWebcamUsage << "\n"
+                     "       model.vrm [model.vrm...]\n"
+                  << "       " << argv[0] << " --bench-springs model.vrm\n"
+                  << "       " << argv[0] << " --bench-ktx2 model.vrm\n"
+                  << "       " << argv[0] << " --bench-render gl|vulkan [--frames N]"
+                     " [--instances N] [--dump-frame out.ppm] [--check-allocs] [--gl33] model.vrm\n"
+                  << "       " << argv[0] << " --bench-accessors\n"
+                  << "       " << argv[0] << " --bench-preprocess [--frames N] [--gl33]\n";
+        return 1;
+    }
+    const char* modelPath = modelPaths[0].c_str();
+    if (benchSprings) return benchSpringBones(modelPath);
+    if (benchKtx2) return benchmarkKtx2Textures(modelPath) ? 0 : 1;
+    if (!benchRenderer.empty())
+        return benchRender(modelPath, benchRenderer, benchFrames, benchInstances,
+                           forceGL33, dumpFrame, checkAllocs);
+
+    // Startup runs in parallel: the tracker (cascade + webcam, which alone can
+    // take ~1 s) and the VRM parse/decode run on worker threads while this
+    // thread brings up the window and GL context. Only GL work stays here.
+    StartupTimeline startup;
+
+    // Load the embedded Haar cascade straight from memory and open the webcam,
+    // or attach to FreeTuber-tracker's pose channel
+    Webcam cap;
+    PoseChannelReader poseChannel;
+    std::future<bool> trackerReady;
+    if (!externalTracker) {
+        trackerReady = std::async(std::launch::async, [&] {
+            auto t = startup.now();
+            initHeadPoseFromMemory(embeddedHaarCascade(), detectorKind);
+            setFaceTracking(faceTracking);
+            setMotionGate(motionGate);
+            startup.record("load face detector", t);
+            t = startup.now();
+            bool opened = cap.open(0, webcamSettings);
+            if (opened && saveCameraProfile) cap.saveProfile();
+            startup.record("open webcam", t);
+            return opened;
+        });
+    }
+
+    // Parse glTF and decode images, once per distinct file
+    std::vector<std::string> uniquePaths;
+    for (const std::string& p : modelPaths) {
+        std::string key = ModelLibrary::key(p);
+        if (std::find(uniquePaths.begin(), uniquePaths.end(), key) == uniquePaths.end())
+            uniquePaths.push_back(key);
+    }
+    std::vector<VRMData> vrms(uniquePaths.size());
+    std::vector<std::future<bool>> modelsReady;
+    for (size_t m = 0; m < uniquePaths.size(); ++m) {
+        modelsReady.push_back(std::async(std::launch::async, [&, m] {
+            VRMData& vrm = vrms[m];
+            bool ok = parseVRM(uniquePaths[m], vrm);
+            if (ok) {
+                std::string file = std::filesystem::path(uniquePaths[m]).filename().string();
+                startup.record(file + ": parse glTF", vrm.parse.begin, vrm.parse.end);
+                startup.record(file + ": decompress geometry", vrm.geometry.begin, vrm.geometry.end);
+                startup.record(file + ": decode images", vrm.decode.begin, vrm.decode.end);
+                startup.record(file + ": build vertex data", vrm.build.begin, vrm.build.end);
+                startup.record(file + ": normals/tangents", vrm.frames.begin, vrm.frames.end);
+            }
+            return ok;
+        }));
+    }
+
+    // GLFW + GLAD initialization
+    auto tWindow = startup.now();
+    GLFWwindow* window = createGLWindow(true, forceGL33);
+    if (!window) return -1;
 
     // Camera & callbacks
     Camera cam(800,600);
@@ -89,105 +441,134 @@ int main(int argc, char** argv) {
     glfwSetMouseButtonCallback(window,    mouse_button_callback);
     glfwSetCursorPosCallback(window,      cursor_pos_callback);
     glfwSetScrollCallback(window,         scroll_callback);
-    glViewport(0,0,800,600);
-
-    // Load shaders from embedded strings
-    GLuint shader = loadShaderProgramFromSource(vertexShaderSrc, fragmentShaderSrc);
-    if (!shader) return -1;
-    glUseProgram(shader);
-
-    // Lighting uniforms
-    glUniform3f(glGetUniformLocation(shader,"uLightDir"), 0.5f,1.0f,0.3f);
-    glUniform3f(glGetUniformLocation(shader,"uAmbient"),  0.2f,0.2f,0.2f);
-
-    // Load VRM from argument path
-    if (!loadVRM(argv[1])) {
-        std::cerr<<"Failed to load VRM\n"; return -1;
-    }
-
-    // Split meshes by name (head vs body)
-    std::vector<int> headMeshIndices, bodyMeshIndices;
-    for (int i = 0; i < (int)meshes.size(); ++i) {
-        std::string n = meshes[i].name;
-        std::transform(n.begin(), n.end(), n.begin(), [](unsigned char c){ return std::tolower(c); });
-        if (n.find("head") != std::string::npos ||
-            n.find("hair") != std::string::npos ||
-            n.find("face") != std::string::npos) {
-            headMeshIndices.push_back(i);
-        } else {
-            bodyMeshIndices.push_back(i);
+    glfwSetDropCallback(window,           drop_callback);
+    glfwSetKeyCallback(window,            key_callback);
+    startup.record("create window + GL context", tWindow);
+
+    // Pipeline state and shaders (embedded strings)
+    auto tShaders = startup.now();
+    auto renderer = std::make_unique<GLRenderer>((GLADloadproc)glfwGetProcAddress, !forceGL33);
+    if (!renderer->valid()) return -1;
+    activeRenderer = renderer.get();
+    renderer->resize(800, 600);
+    startup.record("compile shaders", tShaders);
+
+    // Upload each VRM once the workers have parsed it; avatars showing the
+    // same file share the upload
+    auto tUpload = startup.now();
+    std::vector<std::shared_ptr<const Model>> uploaded;
+    for (size_t m = 0; m < uniquePaths.size(); ++m) {
+        if (!modelsReady[m].get()) {
+            FT_LOG(Error, "Failed to load VRM {}", uniquePaths[m]); return -1;
         }
+        Model model;
+        uploadVRM(std::move(vrms[m]), model);
+        uploaded.push_back(ModelLibrary::shared().publish(uniquePaths[m], std::move(model)));
     }
+    startup.record("GL upload", tUpload);
 
-    // Open webcam
-    cv::VideoCapture cap(0);
-    if (!cap.isOpened()) {
-        std::cerr<<"Webcam open failed\n"; return -1;
-    }
+    // Side by side; head tracking drives the first avatar
+    std::vector<AvatarInstance> avatars;
+    for (size_t a = 0; a < modelPaths.size(); ++a)
+        avatars.emplace_back(ModelLibrary::shared().find(modelPaths[a]),
+                             avatarSlot(a, modelPaths.size()));
+    if (avatars.size() > 1)
+        FT_LOG(Info, "Scene: {} avatars from {} models", avatars.size(), uniquePaths.size());
+    uploaded.clear();   // the avatars own them now
+
+    ModelSwapper swapper(modelPath);
+    modelSwapper = &swapper;
+    if (watchModelFile) swapper.watch(modelPath);
 
-    // Projection uniform
-    glm::mat4 proj = glm::perspective(
-        glm::radians(45.0f), 800.0f/600.0f, 0.1f, 100.0f
-    );
-    glUniformMatrix4fv(
-        glGetUniformLocation(shader,"uProj"),
-        1, GL_FALSE, &proj[0][0]
-    );
+    if (trackerReady.valid() && !trackerReady.get()) {
+        FT_LOG(Error, "Webcam open failed"); return -1;
+    }
 
-    GLint locModel = glGetUniformLocation(shader,"uModel");
-    GLint locView  = glGetUniformLocation(shader,"uView");
+    FrameState frameState;
+    frameState.proj  = glm::perspective(glm::radians(45.0f), 800.0f/600.0f, 0.1f, 100.0f);
 
-    // Main loop
+    // Main loop; the camera frame and every per-frame buffer below are reused,
+    // so a steady-state frame makes no heap allocations of its own
+    cv::Mat frame;
+    TrackingFrame tracking;
+    std::unique_ptr<GpuPreprocessor> preprocessor;   // created on first use
+    FrameAllocCounter allocs;
+    bool firstFrame = true;
+    double lastTime = glfwGetTime();
     while (!glfwWindowShouldClose(window)) {
-        // Camera view
-        glm::mat4 view = cam.getView();
-        glUniformMatrix4fv(locView, 1, GL_FALSE, &view[0][0]);
-
-        // Head pose & smoothing
-        cv::Mat frame; cap >> frame;
-        glm::mat4 rawHead = estimateHead(frame);
-        glm::mat4 headM   = glm::inverse(rawHead);
-        glm::quat HQ      = glm::quat_cast(headM);
-        prevHeadQuat      = glm::slerp(prevHeadQuat, HQ, smoothAlpha);
-        glm::mat4 smoothHeadM = glm::mat4_cast(prevHeadQuat);
-
-        // Build head transform (same pivot logic as before)
-        glm::mat4 Tneg = glm::translate(glm::mat4(1.0f), -headPivot);
-        glm::mat4 Tpos = glm::translate(glm::mat4(1.0f),  headPivot);
-        glm::mat4 headModel = Tpos * smoothHeadM * Tneg * modelMat;
-
-        // Draw
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        glEnable(GL_DEPTH_TEST);
-
-        // BODY PASS
-        glUniformMatrix4fv(locModel, 1, GL_FALSE, &modelMat[0][0]);
-        for (int idx : bodyMeshIndices) {
-            auto& m = meshes[idx];
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, m.diffuseTex);
-            glBindVertexArray(m.vao);
-            glDrawElements(GL_TRIANGLES, (GLsizei)m.count, GL_UNSIGNED_INT, nullptr);
+        double nowTime = glfwGetTime();
+        float  dt      = (float)(nowTime - lastTime);
+        lastTime = nowTime;
+
+        // Swap in a newly loaded model at the frame boundary, for every
+        // avatar that showed the one it replaces
+        std::shared_ptr<const Model> shown = avatars[0].model(), next = shown;
+        if (swapper.update(next)) {
+            for (AvatarInstance& a : avatars)
+                if (a.model() == shown) a.setModel(next);
+        }
+
+        // Head pose
+        glm::mat4 rawHead(1.0f);
+        bool haveHead = true;
+        if (externalTracker) {
+            // Never blocks; holds the last good pose while the tracker restarts
+            PoseSample sample;
+            poseChannel.poll(sample);
+            rawHead = glm::mat4_cast(sample.rotation);
+        } else {
+            {
+                ExternalAllocScope capture;
+                cap.read(frame);
+            }
+            if (preprocessOnGpu && !preprocessor) {
+                preprocessor = std::make_unique<GpuPreprocessor>();
+                if (!preprocessor->valid()) {
+                    FT_LOG(Warn, "Preprocess: GPU path unavailable, staying on the CPU");
+                    preprocessOnGpu = false;
+                    preprocessor.reset();
+                }
+            }
+            if (preprocessOnGpu) {
+                // A frame behind the camera; holds the head until the first result
+                haveHead = preprocessor->process(frame, faceDetectorNeedsColor(), tracking);
+                if (haveHead) rawHead = estimateHead(tracking);
+            } else {
+                rawHead = estimateHead(frame);
+            }
         }
+        if (haveHead) avatars[0].setHeadRotation(glm::quat_cast(glm::inverse(rawHead)));
 
-        // HEAD PASS (transparent textures blend correctly)
-        glUniformMatrix4fv(locModel, 1, GL_FALSE, &headModel[0][0]);
-        for (int idx : headMeshIndices) {
-            auto& m = meshes[idx];
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, m.diffuseTex);
-            glBindVertexArray(m.vao);
-            glDrawElements(GL_TRIANGLES, (GLsizei)m.count, GL_UNSIGNED_INT, nullptr);
+        size_t recomputed = 0, nodes = 0;
+        for (AvatarInstance& a : avatars) {
+            recomputed += a.update(dt);
+            nodes      += a.model()->skeleton.size();
         }
+        FT_LOG_EVERY_MS(Debug, 5000, "Skeleton: {} of {} node transforms recomputed this frame",
+                        recomputed, nodes);
+
+        frameState.view = cam.getView();
+        renderer->drawAvatars(frameState, avatars);
 
         glfwSwapBuffers(window);
         glfwPollEvents();
+
+        AllocStats frameAllocs = allocs.lap();
+        FT_LOG_EVERY_MS(Debug, 5000, "Heap: {} allocations last frame, {} of {} frames allocated",
+                        frameAllocs.count, allocs.allocatingFrames, allocs.frames);
+
+        if (firstFrame) {
+            startup.report("Time to first frame");
+            firstFrame = false;
+        }
     }
 
+    // GL objects go before the context does
+    activeRenderer = nullptr;
+    preprocessor.reset();
+    avatars.clear();
+    renderer.reset();
     glfwTerminate();
 
-    // Optionally remove temp cascade XML file:
-    // std::filesystem::remove(cascadeTempPath);
-
     return 0;
 }
@@ -0,0 +1,129 @@
+// FreeTuber-tracker: runs webcam capture + head-pose estimation in its own
+// process and publishes poses to the renderer over shared memory, so a camera
+// stall or OpenCV hiccup cannot freeze the avatar.
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sched.h>
+#include <opencv2/opencv.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include "AllocCounter.hpp"
+#include "HeadPose.hpp"
+#include "PoseChannel.hpp"
+#include "Webcam.hpp"
+#include "Log.hpp"
+#include "EmbeddedResources.hpp"  // Embedded cascade
+
+static std::atomic<bool> running{true};
+
+static void onSignal(int) { running = false; }
+
+static bool pinToCpu(int cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+}
+
+int main(int argc, char** argv) {
+    int cameraIndex = 0;
+    int cpu = -1;
+    const char* channel = kPoseChannelName;
+    FaceDetectorKind detectorKind = defaultFaceDetector();
+    const char* benchVideo = nullptr;
+    int benchFrames = 0;
+    bool faceTracking = true;
+    bool motionGate = true;
+    bool benchPnP = false;
+    WebcamSettings webcamSettings;
+    bool saveCameraProfile = false;
+    for (int i = 1; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--camera") && i + 1 < argc) {
+            cameraIndex = std::atoi(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--cpu") && i + 1 < argc) {
+            cpu = std::atoi(argv[++i]);
+        } else if (!std::strcmp(argv[i], "--channel") && i + 1 < argc) {
+            channel = argv[++i];
+        } else if (!std::strcmp(argv[i], "--detector") && i + 1 < argc &&
+                   parseFaceDetector(argv[i + 1], detectorKind)) {
+            ++i;
+        } else if (!std::strcmp(argv[i], "--no-klt")) {
+            faceTracking = false;
+        } else if (!std::strcmp(argv[i], "--no-motion-gate")) {
+            motionGate = false;
+        } else if (!std::strcmp(argv[i], "--benchmark") && i + 1 < argc) {
+            benchVideo = argv[++i];
+        } else if (!std::strcmp(argv[i], "--save-camera-profile")) {
+            saveCameraProfile = true;
+        } else if (parseWebcamArg(argc, argv, i, webcamSettings)) {
+            continue;
+        } else if (!std::strcmp(argv[i], "--bench-pnp")) {
+            benchPnP = true;
+        } else if (!std::strcmp(argv[i], "--frames") && i + 1 < argc) {
+            benchFrames = std::atoi(argv[++i]);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--camera N] [--cpu N] [--channel /name] [--detector yunet|haar]"
+                         " [--no-klt] [--no-motion-gate]\n"
+                      << "       " << kWebcamUsage << "\n"
+                      << "       " << argv[0] << " --benchmark video.mp4 [--frames N]\n"
+                      << "       " << argv[0] << " --bench-pnp [--frames N]\n";
+
+            return 1;
+        }
+    }
+
+    logInit();
+    std::signal(SIGINT,  onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    if (cpu >= 0 && !pinToCpu(cpu)) {
+        FT_LOG(Warn, "Failed to pin tracker to CPU {}", cpu);
+    }
+
+    if (benchPnP) return benchmarkPoseSolvers(benchFrames > 0 ? benchFrames : 10000) ? 0 : 1;
+
+    initHeadPoseFromMemory(embeddedHaarCascade(), detectorKind);
+    setFaceTracking(faceTracking);
+    setMotionGate(motionGate);
+    if (benchVideo) return benchmarkFaceDetectors(benchVideo, benchFrames) ? 0 : 1;
+
+    PoseChannelWriter writer;
+    if (!writer.open(channel)) return 1;
+
+    Webcam cap;
+    if (!cap.open(cameraIndex, webcamSettings)) {
+        FT_LOG(Error, "Webcam open failed"); return 1;
+    }
+    if (saveCameraProfile) cap.saveProfile();
+
+    PoseSample sample;
+    cv::Mat frame;
+    FrameAllocCounter allocs;
+    while (running) {
+        bool grabbed;
+        {
+            ExternalAllocScope capture;
+            grabbed = cap.read(frame) && !frame.empty();
+        }
+        if (!grabbed) {
+            FT_LOG(Error, "Webcam read failed");
+            break;
+        }
+        sample.timestampNs = poseClockNowNs();
+
+        glm::mat4 rawHead = estimateHead(frame);
+        sample.rotation   = glm::quat_cast(rawHead);
+        sample.faceFound  = rawHead != glm::mat4(1.0f);
+        sample.frameIndex++;
+        writer.publish(sample);
+
+        AllocStats a = allocs.lap();
+        FT_LOG_EVERY_MS(Debug, 5000, "Tracker heap: {} allocations last frame, {} of {} frames allocated",
+                        a.count, allocs.allocatingFrames, allocs.frames);
+    }
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+// Checks that the per-frame tracking preprocessing and the motion gate stop
+// allocating once warmed up, cv::Mat buffers included. Runs on synthetic
+// frames, so it needs no camera, video or model.
+#include <opencv2/opencv.hpp>
+#include "AllocCounter.hpp"
+#include "HeadPose.hpp"
+#include "Log.hpp"
+#include "MotionGate.hpp"
+
+static constexpr int kVariants     = 8;
+static constexpr int kWarmupFrames = 2 * kVariants;
+static constexpr int kFrames       = 200;
+
+// Smooth noise, shifted a pixel per variant so consecutive frames differ
+static std::vector<cv::Mat> syntheticFrames() {
+    const cv::Size size(1280, 720);
+    cv::Mat base(size, CV_8UC3);
+    cv::RNG rng(1);
+    rng.fill(base, cv::RNG::UNIFORM, 0, 256);
+    cv::GaussianBlur(base, base, cv::Size(0, 0), 3.0);
+    std::vector<cv::Mat> frames(kVariants);
+    for (int v = 0; v < kVariants; ++v) {
+        cv::Mat shift = (cv::Mat_<double>(2, 3) << 1, 0, v, 0, 1, 0);
+        cv::warpAffine(base, frames[v], shift, size, cv::INTER_LINEAR, cv::BORDER_REFLECT);
+    }
+    return frames;
+}
+
+// Runs `step(i)` through the warm-up, then counts the frames after it that
+// allocated; false if any did
+template <class Step>
+static bool expectNoAllocations(const char* name, Step step) {
+    for (int i = 0; i < kWarmupFrames; ++i) step(i);
+
+    FrameAllocCounter allocs;
+    for (int i = 0; i < kFrames; ++i) {
+        step(kWarmupFrames + i);
+        AllocStats a = allocs.lap();
+        if (a.count && allocs.allocatingFrames <= 5) {
+            FT_LOG(Error, "{}: frame {} made {} heap allocations ({} bytes)",
+                   name, kWarmupFrames + i, a.count, a.bytes);
+        }
+    }
+    FT_LOG(Info, "{}: {} of {} steady-state frames allocated ({} allocations)",
+           name, allocs.allocatingFrames, allocs.frames, allocs.allocations);
+    return allocs.allocatingFrames == 0;
+}
+
+int main() {
+    logInit();
+    std::vector<cv::Mat> frames = syntheticFrames();
+    MatAllocScope countMats;
+
+    bool ok = true;
+
+    TrackingFrame prepared;
+    ok &= expectNoAllocations("prepareTrackingFrame", [&](int i) {
+        prepareTrackingFrame(frames[i % kVariants], prepared, true);
+    });
+
+    // Reference taken once; every later frame is compared against it
+    MotionGate gate;
+    gate.update(prepared.gray, cv::Rect(prepared.gray.cols / 4, prepared.gray.rows / 4,
+                                        prepared.gray.cols / 2, prepared.gray.rows / 2));
+    ok &= expectNoAllocations("MotionGate", [&](int i) {
+        prepareTrackingFrame(frames[i % kVariants], prepared, true);
+        gate.skip(prepared.gray);
+    });
+
+    return ok ? 0 : 1;
+}